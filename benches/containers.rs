@@ -0,0 +1,154 @@
+//! Throughput benchmarks for `nstd`'s container and allocator hot paths.
+//!
+//! Each benchmark runs a workload in a loop for a fixed time window and reports the number of
+//! iterations completed along with the average time per iteration, so results can be compared
+//! across commits. Run with:
+//!
+//! ```text
+//! cargo bench --features "nstd_alloc nstd_core nstd_string nstd_vec"
+//! ```
+use core::ptr::addr_of;
+use nstd::{
+    alloc::{nstd_alloc_allocate, nstd_alloc_deallocate},
+    core::{
+        cstr::raw::nstd_core_cstr_raw_len,
+        mem::nstd_core_mem_copy,
+        slice::nstd_core_slice_const_new,
+    },
+    string::{nstd_string_free, nstd_string_new, nstd_string_push},
+    vec::{
+        nstd_vec_extend, nstd_vec_free, nstd_vec_insert, nstd_vec_new, nstd_vec_new_with_cap,
+        nstd_vec_push, nstd_vec_remove,
+    },
+    NSTDUInt32,
+};
+use std::time::{Duration, Instant};
+
+/// The amount of time to spend warming up a benchmark.
+const WARMUP: Duration = Duration::from_millis(100);
+
+/// The amount of time to spend measuring a benchmark.
+const WINDOW: Duration = Duration::from_millis(500);
+
+/// Runs `workload` in a loop for a fixed time window and reports it's throughput.
+fn bench<F: FnMut()>(name: &str, mut workload: F) {
+    // Warm up.
+    let now = Instant::now();
+    while now.elapsed() < WARMUP {
+        workload();
+    }
+    // Measure.
+    let mut iters = 0u128;
+    let now = Instant::now();
+    while now.elapsed() < WINDOW {
+        workload();
+        iters += 1;
+    }
+    let elapsed = now.elapsed();
+    let ns_per_iter = elapsed.as_nanos() / iters;
+    println!("{name}: {iters} iters in {elapsed:.2?} ({ns_per_iter} ns/iter)");
+}
+
+/// Benchmarks `nstd_vec_push`'s growth curve from an empty vector.
+fn vec_push() {
+    bench("vec_push_1024", || {
+        let mut vec = nstd_vec_new(4);
+        for i in 0..1024u32 {
+            // SAFETY: The pushed value is 4 bytes in size.
+            unsafe { assert!(nstd_vec_push(&mut vec, addr_of!(i).cast()) == 0) };
+        }
+        nstd_vec_free(vec);
+    });
+}
+
+/// Benchmarks `nstd_vec_extend`'s growth curve with repeated small batches.
+fn vec_extend() {
+    let batch: [NSTDUInt32; 64] = [7; 64];
+    let batch = nstd_core_slice_const_new(batch.as_ptr().cast(), 4, batch.len());
+    bench("vec_extend_16x64", || {
+        let mut vec = nstd_vec_new(4);
+        for _ in 0..16 {
+            // SAFETY: The slice's data is valid for the duration of the call.
+            unsafe { assert!(nstd_vec_extend(&mut vec, &batch) == 0) };
+        }
+        nstd_vec_free(vec);
+    });
+}
+
+/// Benchmarks element shifting in `nstd_vec_insert` and `nstd_vec_remove`.
+fn vec_insert_remove() {
+    let mut vec = nstd_vec_new_with_cap(4, 1024);
+    for i in 0..1024u32 {
+        // SAFETY: The pushed value is 4 bytes in size.
+        unsafe { assert!(nstd_vec_push(&mut vec, addr_of!(i).cast()) == 0) };
+    }
+    bench("vec_insert_remove_front_1024", || {
+        let v = 0u32;
+        // SAFETY: The inserted value is 4 bytes in size.
+        unsafe { assert!(nstd_vec_insert(&mut vec, addr_of!(v).cast(), 0) == 0) };
+        assert!(nstd_vec_remove(&mut vec, 0) == 0);
+    });
+    nstd_vec_free(vec);
+}
+
+/// Benchmarks `nstd_string_push`'s character encoding and append path.
+fn string_push() {
+    bench("string_push_1024", || {
+        let mut string = nstd_string_new();
+        for _ in 0..1024 {
+            assert!(nstd_string_push(&mut string, 'v' as u32) == 0);
+        }
+        nstd_string_free(string);
+    });
+}
+
+/// Benchmarks `nstd_core_mem_copy` across several buffer sizes.
+fn mem_copy() {
+    for size in [16usize, 256, 4096, 65536] {
+        let src = vec![0xA5u8; size];
+        let mut dest = vec![0u8; size];
+        bench(&format!("mem_copy_{size}"), || {
+            // SAFETY: Both buffers are `size` bytes in size.
+            unsafe { nstd_core_mem_copy(dest.as_mut_ptr(), src.as_ptr(), size) };
+            std::hint::black_box(&mut dest);
+        });
+    }
+}
+
+/// Benchmarks `nstd_core_cstr_raw_len` across several string lengths.
+fn cstr_raw_len() {
+    for len in [15usize, 255, 4095] {
+        let mut cstr = vec![b'x' as core::ffi::c_char; len];
+        cstr.push(0);
+        bench(&format!("cstr_raw_len_{len}"), || {
+            // SAFETY: The C string is null terminated.
+            let n = unsafe { nstd_core_cstr_raw_len(cstr.as_ptr()) };
+            assert!(std::hint::black_box(n) == len);
+        });
+    }
+}
+
+/// Benchmarks `nstd_alloc_allocate`/`nstd_alloc_deallocate` round-trips at several size classes.
+fn alloc_round_trip() {
+    for size in [16usize, 256, 4096, 65536] {
+        bench(&format!("alloc_round_trip_{size}"), || {
+            // SAFETY: `size` is never zero.
+            unsafe {
+                let mut mem = nstd_alloc_allocate(size);
+                assert!(!mem.is_null());
+                std::hint::black_box(mem);
+                nstd_alloc_deallocate(&mut mem, size);
+            }
+        });
+    }
+}
+
+fn main() {
+    vec_push();
+    vec_extend();
+    vec_insert_remove();
+    string_push();
+    mem_copy();
+    cstr_raw_len();
+    alloc_round_trip();
+}
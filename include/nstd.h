@@ -3,9 +3,12 @@
 #include "nstd/alloc.h"
 #include "nstd/core.h"
 #include "nstd/cstring.h"
+#include "nstd/hash_map.h"
 #include "nstd/heap_ptr.h"
+#include "nstd/interner.h"
 #include "nstd/nstd.h"
 #include "nstd/os.h"
+#include "nstd/queue.h"
 #include "nstd/shared_ptr.h"
 #include "nstd/string.h"
 #include "nstd/vec.h"
@@ -1,5 +1,8 @@
 #ifndef NSTD_ALLOC_H_INCLUDED
 #define NSTD_ALLOC_H_INCLUDED
+#include "alloc/arena.h"
+#include "alloc/pool.h"
+#include "alloc/stats.h"
 #include "core/def.h"
 #include "nstd.h"
 NSTDCPPSTART
@@ -35,6 +38,24 @@ NSTDAPI NSTDAnyMut nstd_alloc_allocate(NSTDUSize size);
 /// This operation is unsafe because the behaviour is undefined if `size` is zero.
 NSTDAPI NSTDAnyMut nstd_alloc_allocate_zeroed(NSTDUSize size);
 
+/// Allocates a block of memory on the heap, aligned to `align` bytes.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize size` - The number of bytes to allocate on the heap.
+///
+/// - `NSTDUSize align` - The alignment (in bytes) of the allocated memory.
+///
+/// # Returns
+///
+/// `NSTDAnyMut ptr` - A pointer to the allocated memory, null on error.
+///
+/// # Safety
+///
+/// This operation is unsafe because the behaviour is undefined if `size` is zero or `align` is not
+/// a power of two.
+NSTDAPI NSTDAnyMut nstd_alloc_allocate_aligned(NSTDUSize size, NSTDUSize align);
+
 /// Reallocates a block of memory previously allocated by `nstd_alloc_allocate[_zeroed]`.
 ///
 /// If everything goes right, the pointer will point to the new memory location and 0 will be
@@ -59,6 +80,33 @@ NSTDAPI NSTDAnyMut nstd_alloc_allocate_zeroed(NSTDUSize size);
 /// `nstd_alloc_allocate[_zeroed]`.
 NSTDAPI NSTDErrorCode nstd_alloc_reallocate(NSTDAnyMut *ptr, NSTDUSize size, NSTDUSize new_size);
 
+/// Reallocates a block of memory previously allocated by `nstd_alloc_allocate_aligned`.
+///
+/// If everything goes right, the pointer will point to the new memory location and 0 will be
+/// returned. If this is not the case and allocation fails, the pointer will remain untouched and a
+/// value of nonzero is returned.
+///
+/// # Parameters:
+///
+/// - `NSTDAnyMut *ptr` - A pointer to the allocated memory.
+///
+/// - `NSTDUSize size` - The number of bytes currently allocated.
+///
+/// - `NSTDUSize new_size` - The number of bytes to reallocate.
+///
+/// - `NSTDUSize align` - The alignment (in bytes) of the allocated memory.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// This operation is unsafe because the behaviour is undefined if `ptr` is not a value returned by
+/// `nstd_alloc_allocate_aligned`, or `align` does not match the value used for the allocation.
+NSTDAPI NSTDErrorCode nstd_alloc_reallocate_aligned(NSTDAnyMut *ptr, NSTDUSize size,
+NSTDUSize new_size, NSTDUSize align);
+
 /// Deallocates a block of memory previously allocated by `nstd_alloc_allocate[_zeroed]`.
 ///
 /// # Parameters:
@@ -73,5 +121,21 @@ NSTDAPI NSTDErrorCode nstd_alloc_reallocate(NSTDAnyMut *ptr, NSTDUSize size, NST
 /// `nstd_alloc_allocate[_zeroed]`.
 NSTDAPI void nstd_alloc_deallocate(NSTDAnyMut *ptr, NSTDUSize size);
 
+/// Deallocates a block of memory previously allocated by `nstd_alloc_allocate_aligned`.
+///
+/// # Parameters:
+///
+/// - `NSTDAnyMut *ptr` - A pointer to the allocated memory, once freed the pointer is set to null.
+///
+/// - `NSTDUSize size` - The number of bytes to free.
+///
+/// - `NSTDUSize align` - The alignment (in bytes) of the allocated memory.
+///
+/// # Safety
+///
+/// This operation is unsafe because the behaviour is undefined if `ptr` is not a value returned by
+/// `nstd_alloc_allocate_aligned`, or `align` does not match the value used for the allocation.
+NSTDAPI void nstd_alloc_deallocate_aligned(NSTDAnyMut *ptr, NSTDUSize size, NSTDUSize align);
+
 NSTDCPPEND
 #endif
@@ -0,0 +1,74 @@
+#ifndef NSTD_ALLOC_ARENA_H_INCLUDED
+#define NSTD_ALLOC_ARENA_H_INCLUDED
+#include "../nstd.h"
+NSTDCPPSTART
+
+/// An arena allocator.
+///
+/// Arenas allocate large blocks of memory up front and hand out portions of them with a simple
+/// pointer bump, making them ideal for grouping many small, short-lived allocations. Individual
+/// allocations cannot be freed, instead the whole arena is reset (or freed) at once.
+typedef struct {
+    /// A pointer to the first memory block in the chain.
+    NSTDAnyMut head;
+    /// A pointer to the memory block currently being allocated from.
+    NSTDAnyMut current;
+    /// The preferred size (in bytes) of each memory block.
+    NSTDUSize block_size;
+} NSTDArena;
+
+/// Creates a new arena allocator.
+///
+/// The arena does not allocate until it is first allocated from.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize block_size` - The preferred size (in bytes) of each of the arena's memory blocks.
+/// Allocations larger than `block_size` get a dedicated block.
+///
+/// # Returns
+///
+/// `NSTDArena arena` - The new arena allocator.
+///
+/// # Panics
+///
+/// This function will panic if `block_size` is zero.
+NSTDAPI NSTDArena nstd_alloc_arena_new(NSTDUSize block_size);
+
+/// Allocates a block of memory within an arena.
+///
+/// The returned memory is valid until the arena is either reset or freed.
+///
+/// # Parameters:
+///
+/// - `NSTDArena *arena` - The arena to allocate from.
+///
+/// - `NSTDUSize size` - The number of bytes to allocate.
+///
+/// # Returns
+///
+/// `NSTDAnyMut ptr` - A pointer to the allocated memory, null on error.
+///
+/// # Safety
+///
+/// This operation is unsafe because the behaviour is undefined if `size` is zero.
+NSTDAPI NSTDAnyMut nstd_alloc_arena_allocate(NSTDArena *arena, NSTDUSize size);
+
+/// Resets an arena allocator, invalidating all of its active allocations.
+///
+/// The arena's memory blocks are retained for reuse, no memory is returned to the heap.
+///
+/// # Parameters:
+///
+/// - `NSTDArena *arena` - The arena to reset.
+NSTDAPI void nstd_alloc_arena_reset(NSTDArena *arena);
+
+/// Frees an instance of `NSTDArena`, invalidating all of its active allocations.
+///
+/// # Parameters:
+///
+/// - `NSTDArena arena` - The arena to free.
+NSTDAPI void nstd_alloc_arena_free(NSTDArena arena);
+
+NSTDCPPEND
+#endif
@@ -0,0 +1,51 @@
+#ifndef NSTD_ALLOC_POOL_H_INCLUDED
+#define NSTD_ALLOC_POOL_H_INCLUDED
+#include "../nstd.h"
+NSTDCPPSTART
+
+/// Allocates a block of memory on the heap through the current thread's allocation pool.
+///
+/// Allocations of 256 bytes or less are rounded up to a size class and served from the calling
+/// thread's free lists without any cross-thread synchronization, larger allocations fall back to
+/// `nstd_alloc_allocate`. Memory returned by this function must be freed with
+/// `nstd_alloc_pool_deallocate`.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize size` - The number of bytes to allocate on the heap.
+///
+/// # Returns
+///
+/// `NSTDAnyMut ptr` - A pointer to the allocated memory, null on error.
+///
+/// # Safety
+///
+/// This operation is unsafe because the behaviour is undefined if `size` is zero.
+NSTDAPI NSTDAnyMut nstd_alloc_pool_allocate(NSTDUSize size);
+
+/// Deallocates a block of memory previously allocated by `nstd_alloc_pool_allocate`.
+///
+/// Blocks of 256 bytes or less are cached on the calling thread's free lists for reuse, larger
+/// blocks are returned to the heap immediately.
+///
+/// # Parameters:
+///
+/// - `NSTDAnyMut *ptr` - A pointer to the allocated memory, once freed the pointer is set to null.
+///
+/// - `NSTDUSize size` - The number of bytes that were requested from `nstd_alloc_pool_allocate`.
+///
+/// # Safety
+///
+/// This operation is unsafe because the behaviour is undefined if `ptr` is not a value returned by
+/// `nstd_alloc_pool_allocate`, or `size` does not match the value used for the allocation.
+NSTDAPI void nstd_alloc_pool_deallocate(NSTDAnyMut *ptr, NSTDUSize size);
+
+/// Returns the largest allocation size (in bytes) that is served from the pool's free lists.
+///
+/// # Returns
+///
+/// `NSTDUSize size` - The pool's maximum cached allocation size.
+NSTDAPI NSTDUSize nstd_alloc_pool_max_size(void);
+
+NSTDCPPEND
+#endif
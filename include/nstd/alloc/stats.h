@@ -0,0 +1,39 @@
+#ifndef NSTD_ALLOC_STATS_H_INCLUDED
+#define NSTD_ALLOC_STATS_H_INCLUDED
+#include "../nstd.h"
+NSTDCPPSTART
+
+/// A snapshot of `nstd`'s global allocation counters.
+typedef struct {
+    /// The number of calls made to the `nstd_alloc_allocate[_zeroed|_aligned]` functions.
+    NSTDUSize allocations;
+    /// The total number of bytes requested from the allocation functions.
+    NSTDUSize allocated_bytes;
+    /// The number of allocations that returned null.
+    NSTDUSize allocation_failures;
+    /// The number of calls made to the `nstd_alloc_reallocate[_aligned]` functions.
+    NSTDUSize reallocations;
+    /// The number of reallocations that failed.
+    NSTDUSize reallocation_failures;
+    /// The number of calls made to the `nstd_alloc_deallocate[_aligned]` functions.
+    NSTDUSize deallocations;
+    /// The total number of bytes released through the deallocation functions.
+    NSTDUSize deallocated_bytes;
+    /// The number of calls made to `nstd_vec_reserve`.
+    NSTDUSize vec_reserves;
+    /// The number of times a vector's capacity was grown automatically to make room for a push.
+    NSTDUSize vec_growths;
+} NSTDAllocStats;
+
+/// Takes a snapshot of `nstd`'s global allocation counters.
+///
+/// The counters are only maintained when `nstd` is built with the `nstd_alloc_stats` feature,
+/// without it the allocation functions are left completely uninstrumented.
+///
+/// # Parameters:
+///
+/// - `NSTDAllocStats *out` - Returns as a snapshot of the allocation counters.
+NSTDAPI void nstd_alloc_stats(NSTDAllocStats *out);
+
+NSTDCPPEND
+#endif
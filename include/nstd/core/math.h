@@ -1,6 +1,7 @@
 #ifndef NSTD_CORE_MATH_H_INCLUDED
 #define NSTD_CORE_MATH_H_INCLUDED
 #include "../nstd.h"
+#include "slice.h"
 NSTDCPPSTART
 
 /// Converts radians to degrees.
@@ -262,5 +263,422 @@ NSTDAPI NSTDUSize nstd_core_math_clamp_usize(NSTDUSize x, NSTDUSize min, NSTDUSi
 /// Panics if `min` > `max`.
 NSTDAPI NSTDISize nstd_core_math_clamp_isize(NSTDISize x, NSTDISize min, NSTDISize max);
 
+/// Clamps each value in `slice` to the bounds `min` and `max` in place.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDFloat32`s to clamp.
+///
+/// - `NSTDFloat32 min` - The minimum clamp value.
+///
+/// - `NSTDFloat32 max` - The maximum clamp value.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDFloat32`, `min` > `max`, `min` is
+/// NaN, or `max` is NaN.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_clamp_slice_f32(NSTDSliceMut *slice, NSTDFloat32 min, NSTDFloat32 max);
+/// Clamps each value in `slice` to the bounds `min` and `max` in place.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDFloat64`s to clamp.
+///
+/// - `NSTDFloat64 min` - The minimum clamp value.
+///
+/// - `NSTDFloat64 max` - The maximum clamp value.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDFloat64`, `min` > `max`, `min` is
+/// NaN, or `max` is NaN.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_clamp_slice_f64(NSTDSliceMut *slice, NSTDFloat64 min, NSTDFloat64 max);
+/// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDUInt8`s to operate on.
+///
+/// - `NSTDUInt8 v` - The value to add to each element.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDUInt8`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_add_slice_u8(NSTDSliceMut *slice, NSTDUInt8 v);
+/// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDInt8`s to operate on.
+///
+/// - `NSTDInt8 v` - The value to add to each element.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDInt8`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_add_slice_i8(NSTDSliceMut *slice, NSTDInt8 v);
+/// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDUInt16`s to operate on.
+///
+/// - `NSTDUInt16 v` - The value to add to each element.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDUInt16`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_add_slice_u16(NSTDSliceMut *slice, NSTDUInt16 v);
+/// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDInt16`s to operate on.
+///
+/// - `NSTDInt16 v` - The value to add to each element.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDInt16`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_add_slice_i16(NSTDSliceMut *slice, NSTDInt16 v);
+/// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDUInt32`s to operate on.
+///
+/// - `NSTDUInt32 v` - The value to add to each element.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDUInt32`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_add_slice_u32(NSTDSliceMut *slice, NSTDUInt32 v);
+/// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDInt32`s to operate on.
+///
+/// - `NSTDInt32 v` - The value to add to each element.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDInt32`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_add_slice_i32(NSTDSliceMut *slice, NSTDInt32 v);
+/// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDUInt64`s to operate on.
+///
+/// - `NSTDUInt64 v` - The value to add to each element.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDUInt64`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_add_slice_u64(NSTDSliceMut *slice, NSTDUInt64 v);
+/// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDInt64`s to operate on.
+///
+/// - `NSTDInt64 v` - The value to add to each element.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDInt64`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_add_slice_i64(NSTDSliceMut *slice, NSTDInt64 v);
+/// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDUSize`s to operate on.
+///
+/// - `NSTDUSize v` - The value to add to each element.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDUSize`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_add_slice_usize(NSTDSliceMut *slice, NSTDUSize v);
+/// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDISize`s to operate on.
+///
+/// - `NSTDISize v` - The value to add to each element.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDISize`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_add_slice_isize(NSTDSliceMut *slice, NSTDISize v);
+/// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDUInt8`s to operate on.
+///
+/// - `NSTDUInt8 v` - The value to multiply each element by.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDUInt8`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_mul_slice_u8(NSTDSliceMut *slice, NSTDUInt8 v);
+/// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDInt8`s to operate on.
+///
+/// - `NSTDInt8 v` - The value to multiply each element by.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDInt8`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_mul_slice_i8(NSTDSliceMut *slice, NSTDInt8 v);
+/// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDUInt16`s to operate on.
+///
+/// - `NSTDUInt16 v` - The value to multiply each element by.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDUInt16`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_mul_slice_u16(NSTDSliceMut *slice, NSTDUInt16 v);
+/// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDInt16`s to operate on.
+///
+/// - `NSTDInt16 v` - The value to multiply each element by.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDInt16`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_mul_slice_i16(NSTDSliceMut *slice, NSTDInt16 v);
+/// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDUInt32`s to operate on.
+///
+/// - `NSTDUInt32 v` - The value to multiply each element by.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDUInt32`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_mul_slice_u32(NSTDSliceMut *slice, NSTDUInt32 v);
+/// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDInt32`s to operate on.
+///
+/// - `NSTDInt32 v` - The value to multiply each element by.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDInt32`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_mul_slice_i32(NSTDSliceMut *slice, NSTDInt32 v);
+/// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDUInt64`s to operate on.
+///
+/// - `NSTDUInt64 v` - The value to multiply each element by.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDUInt64`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_mul_slice_u64(NSTDSliceMut *slice, NSTDUInt64 v);
+/// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDInt64`s to operate on.
+///
+/// - `NSTDInt64 v` - The value to multiply each element by.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDInt64`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_mul_slice_i64(NSTDSliceMut *slice, NSTDInt64 v);
+/// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDUSize`s to operate on.
+///
+/// - `NSTDUSize v` - The value to multiply each element by.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDUSize`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_mul_slice_usize(NSTDSliceMut *slice, NSTDUSize v);
+/// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+/// instead of overflowing.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDISize`s to operate on.
+///
+/// - `NSTDISize v` - The value to multiply each element by.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDISize`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_saturating_mul_slice_isize(NSTDSliceMut *slice, NSTDISize v);
+/// Multiplies each value in `slice` by `scale` and adds `offset` to it in place.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDFloat32`s to scale.
+///
+/// - `NSTDFloat32 scale` - The value to multiply each element by.
+///
+/// - `NSTDFloat32 offset` - The value to add to each element after scaling.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDFloat32`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_scale_add_slice_f32(NSTDSliceMut *slice, NSTDFloat32 scale,
+NSTDFloat32 offset);
+/// Multiplies each value in `slice` by `scale` and adds `offset` to it in place.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of `NSTDFloat64`s to scale.
+///
+/// - `NSTDFloat64 scale` - The value to multiply each element by.
+///
+/// - `NSTDFloat64 offset` - The value to add to each element after scaling.
+///
+/// # Panics
+///
+/// Panics if `slice`'s element size is not the size of `NSTDFloat64`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_math_scale_add_slice_f64(NSTDSliceMut *slice, NSTDFloat64 scale,
+NSTDFloat64 offset);
+
 NSTDCPPEND
 #endif
@@ -41,6 +41,52 @@ NSTDAPI NSTDBool nstd_core_mem_compare(const NSTDByte *buf1, const NSTDByte *buf
 /// buffer is at least `size` bytes in size.
 NSTDAPI void nstd_core_mem_fill(NSTDByte *buf, NSTDUSize size, NSTDByte fill);
 
+/// Searches a memory buffer for the first occurrence of `delim`.
+///
+/// Runs of bytes that do not contain `delim` are skipped a machine word at a time.
+///
+/// # Parameters:
+///
+/// - `const NSTDByte *buf` - The memory buffer to search.
+///
+/// - `NSTDUSize size` - The size of the memory buffer.
+///
+/// - `NSTDByte delim` - The byte value to search for.
+///
+/// # Returns
+///
+/// `const NSTDByte *match` - A pointer to the first occurrence of `delim` in `buf`, or null if
+/// the buffer does not contain `delim`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if the caller does not ensure that the memory
+/// buffer is at least `size` bytes in size.
+NSTDAPI const NSTDByte *nstd_core_mem_find(const NSTDByte *buf, NSTDUSize size, NSTDByte delim);
+
+/// Searches a memory buffer for the last occurrence of `delim`.
+///
+/// Runs of bytes that do not contain `delim` are skipped a machine word at a time.
+///
+/// # Parameters:
+///
+/// - `const NSTDByte *buf` - The memory buffer to search.
+///
+/// - `NSTDUSize size` - The size of the memory buffer.
+///
+/// - `NSTDByte delim` - The byte value to search for.
+///
+/// # Returns
+///
+/// `const NSTDByte *match` - A pointer to the last occurrence of `delim` in `buf`, or null if
+/// the buffer does not contain `delim`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if the caller does not ensure that the memory
+/// buffer is at least `size` bytes in size.
+NSTDAPI const NSTDByte *nstd_core_mem_rfind(const NSTDByte *buf, NSTDUSize size, NSTDByte delim);
+
 /// Copies `num` bytes from `src` to `dest`.
 ///
 /// # Parameters:
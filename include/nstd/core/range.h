@@ -92,4 +92,36 @@ typedef struct {
     NSTDFloat64 end;
 } NSTDFRange64;
 
+/// A function called for each batch of a range.
+///
+/// The first parameter is the batch's sub-range and the second parameter is the user data that
+/// was passed along with the function.
+typedef void (*NSTDURangeForEach)(NSTDURange, NSTDAnyMut);
+
+NSTDCPPSTART
+
+/// Invokes `for_each` once per batch of a range instead of once per index, amortizing the
+/// indirect call over whole batches of elements.
+///
+/// Batches are aligned to multiples of `batch_size`: the first batch ends at the next multiple
+/// of `batch_size` and every following batch covers one full multiple, except the last which is
+/// clamped to `range.end`.
+///
+/// # Parameters:
+///
+/// - `NSTDURange range` - The range of indices to cover.
+///
+/// - `NSTDUSize batch_size` - The number of indices in each batch.
+///
+/// - `NSTDURangeForEach for_each` - The function to invoke for each batch.
+///
+/// - `NSTDAnyMut data` - User data to pass along with each batch.
+///
+/// # Panics
+///
+/// This operation will panic if `batch_size` is zero.
+NSTDAPI void nstd_core_range_u_for_each_batched(NSTDURange range, NSTDUSize batch_size,
+NSTDURangeForEach for_each, NSTDAnyMut data);
+
+NSTDCPPEND
 #endif
@@ -1,9 +1,18 @@
 #ifndef NSTD_CORE_SLICE_H_INCLUDED
 #define NSTD_CORE_SLICE_H_INCLUDED
 #include "../nstd.h"
+#include "def.h"
 #include "ptr.h"
 NSTDCPPSTART
 
+/// A function used to compare two slice elements.
+///
+/// The first two parameters are pointers to the elements to compare and the third parameter is
+/// the user data that was passed along with the function. The function must return a negative
+/// value if the first element is less than the second, 0 if the two elements are equal, and a
+/// positive value if the first element is greater than the second.
+typedef NSTDInt32 (*NSTDSliceCompare)(NSTDAnyConst, NSTDAnyConst, NSTDAnyMut);
+
 /// An immutable view into a sequence of values in memory.
 typedef struct {
     /// A pointer to the first element in the slice.
@@ -51,7 +60,17 @@ NSTDAPI NSTDUSize nstd_core_slice_const_len(const NSTDSliceConst *slice);
 ///
 /// `NSTDAnyConst element` - A pointer to the element at `pos` or `NSTD_NULL` if `pos` is out
 /// of the slice's boundaries.
-NSTDAPI NSTDAnyConst nstd_core_slice_const_get(const NSTDSliceConst *slice, NSTDUSize pos);
+///
+/// # Note
+///
+/// This function is implemented inline in the header so that C/C++ callers can avoid the
+/// cross-language call overhead in per-element loops.
+static inline NSTDAnyConst nstd_core_slice_const_get(const NSTDSliceConst *slice, NSTDUSize pos) {
+    if (pos < slice->len) {
+        return (const NSTDByte *)slice->ptr.raw + pos * slice->ptr.size;
+    }
+    return NSTD_NULL;
+}
 
 /// Returns an immutable pointer to the first element in the slice.
 ///
@@ -94,6 +113,37 @@ NSTDAPI NSTDAnyConst nstd_core_slice_const_last(const NSTDSliceConst *slice);
 /// This function can cause undefined behavior if either `s1` or `s2`'s data is invalid.
 NSTDAPI NSTDBool nstd_core_slice_const_compare(const NSTDSliceConst *s1, const NSTDSliceConst *s2);
 
+/// Searches a sorted slice for an element that compares equal to `value`.
+///
+/// # Note
+///
+/// `slice` must be sorted by `comparator`, otherwise the result of this operation is unspecified.
+/// If the slice contains multiple elements that compare equal to `value`, a pointer to any one of
+/// them may be returned.
+///
+/// # Parameters:
+///
+/// - `const NSTDSliceConst *slice` - The sorted slice to search.
+///
+/// - `NSTDAnyConst value` - A pointer to the value to search for.
+///
+/// - `NSTDSliceCompare comparator` - The comparison function that the slice is sorted by. The
+/// function is called with a pointer to an element of `slice` as it's first parameter and `value`
+/// as it's second.
+///
+/// - `NSTDAnyMut ctx` - User data to pass to the comparator on each call.
+///
+/// # Returns
+///
+/// `NSTDAnyConst element` - A pointer to an element that compares equal to `value`, or
+/// `NSTD_NULL` if the slice does not contain such an element.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI NSTDAnyConst nstd_core_slice_const_binary_search(const NSTDSliceConst *slice,
+NSTDAnyConst value, NSTDSliceCompare comparator, NSTDAnyMut ctx);
+
 /// A view into a sequence of values in memory.
 typedef struct {
     /// A pointer to the first element in the slice.
@@ -238,5 +288,66 @@ NSTDAPI NSTDBool nstd_core_slice_mut_compare(const NSTDSliceMut *s1, const NSTDS
 /// This function can cause undefined behavior if either `dest` or `src`'s data is invalid.
 NSTDAPI void nstd_core_slice_mut_copy(NSTDSliceMut *dest, const NSTDSliceMut *src);
 
+/// Sorts a slice's elements in place using `comparator`.
+///
+/// This is an unstable introsort, the relative order of elements that compare equal is not
+/// preserved and no additional memory is allocated.
+///
+/// # Note
+///
+/// If `comparator` does not implement a total order over the slice's elements, the order of the
+/// sorted slice is unspecified.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice to sort.
+///
+/// - `NSTDSliceCompare comparator` - The comparison function to sort the slice's elements by.
+///
+/// - `NSTDAnyMut ctx` - User data to pass to the comparator on each call.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_slice_mut_sort(NSTDSliceMut *slice, NSTDSliceCompare comparator,
+NSTDAnyMut ctx);
+
+/// Sorts a slice of signed integers in place in ascending order.
+///
+/// This avoids `nstd_core_slice_mut_sort`'s indirect comparator call for the common integer key
+/// widths, the elements are compared directly as native signed integers instead.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of signed integers to sort.
+///
+/// # Panics
+///
+/// This function will panic if `slice`'s element size is not 1, 2, 4 or 8.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_slice_mut_sort_signed(NSTDSliceMut *slice);
+
+/// Sorts a slice of unsigned integers in place in ascending order.
+///
+/// This avoids `nstd_core_slice_mut_sort`'s indirect comparator call for the common integer key
+/// widths, the elements are compared directly as native unsigned integers instead.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of unsigned integers to sort.
+///
+/// # Panics
+///
+/// This function will panic if `slice`'s element size is not 1, 2, 4 or 8.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+NSTDAPI void nstd_core_slice_mut_sort_unsigned(NSTDSliceMut *slice);
+
 NSTDCPPEND
+#include "slice/par.h"
 #endif
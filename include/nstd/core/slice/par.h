@@ -0,0 +1,77 @@
+#ifndef NSTD_CORE_SLICE_PAR_H_INCLUDED
+#define NSTD_CORE_SLICE_PAR_H_INCLUDED
+#include "../../nstd.h"
+#include "../slice.h"
+NSTDCPPSTART
+
+/// A function to be called for each element in a slice.
+///
+/// The first parameter is a pointer to the element and the second parameter is the user data that
+/// was passed along with the function.
+typedef void (*NSTDSliceParForEach)(NSTDAnyMut, NSTDAnyMut);
+
+/// A function that folds a slice element into an accumulator.
+///
+/// The first parameter is a pointer to the accumulator, the second parameter is a pointer to the
+/// element to fold into the accumulator and the third parameter is the user data that was passed
+/// along with the function.
+typedef void (*NSTDSliceParReduce)(NSTDAnyMut, NSTDAnyConst, NSTDAnyMut);
+
+/// Calls `callback` with a pointer to each element in a slice, splitting the work across a pool
+/// of worker threads.
+///
+/// The slice is partitioned across the machine's available hardware threads on cache line aligned
+/// boundaries, small slices are processed on the calling thread. The call returns once every
+/// element has been visited.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice to operate on.
+///
+/// - `NSTDSliceParForEach callback` - The function to call for each element in the slice.
+///
+/// - `NSTDAnyMut ctx` - User data to pass to the callback on each call.
+///
+/// # Safety
+///
+/// - `slice`'s data must be valid for reads and writes.
+///
+/// - `callback` is called from multiple threads at once, both the callback and `ctx`'s data must
+/// be safe to use concurrently.
+NSTDAPI void nstd_core_slice_par_for_each(NSTDSliceMut *slice, NSTDSliceParForEach callback,
+NSTDAnyMut ctx);
+
+/// Folds each element in a slice into one of `accums`' accumulators, splitting the work across a
+/// pool of worker threads.
+///
+/// The slice is partitioned into up to `accums.len` partitions on cache line aligned boundaries
+/// and each partition's worker folds the partition's elements into it's own accumulator, in
+/// order. The accumulators must be initialized by the caller, accumulators that receive no
+/// elements are left untouched. Once the call returns the caller can combine the accumulators
+/// into the final result.
+///
+/// # Parameters:
+///
+/// - `const NSTDSliceConst *slice` - The slice to operate on.
+///
+/// - `NSTDSliceMut *accums` - A slice of accumulators, one for each worker to use.
+///
+/// - `NSTDSliceParReduce callback` - The function that folds an element into an accumulator.
+///
+/// - `NSTDAnyMut ctx` - User data to pass to the callback on each call.
+///
+/// # Panics
+///
+/// This function will panic if `accums` is empty.
+///
+/// # Safety
+///
+/// - `slice` and `accums`' data must be valid for reads and writes respectively.
+///
+/// - `callback` is called from multiple threads at once, both the callback and `ctx`'s data must
+/// be safe to use concurrently.
+NSTDAPI void nstd_core_slice_par_reduce(const NSTDSliceConst *slice, NSTDSliceMut *accums,
+NSTDSliceParReduce callback, NSTDAnyMut ctx);
+
+NSTDCPPEND
+#endif
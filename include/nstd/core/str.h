@@ -13,6 +13,14 @@ typedef struct {
     NSTDSliceConst bytes;
 } NSTDStrConst;
 
+/// An iterator over the characters of an `NSTDStrConst`.
+typedef struct {
+    /// The string slice being iterated over.
+    NSTDStrConst str;
+    /// The byte offset of the next character to decode.
+    NSTDUSize offset;
+} NSTDStrConstChars;
+
 /// Creates a new instance of `NSTDStrConst` from a C string slice.
 ///
 /// # Parameters:
@@ -59,6 +67,27 @@ NSTDAPI NSTDStrConst nstd_core_str_const_from_cstr_unchecked(const NSTDCStrConst
 /// This operation will panic if `bytes.ptr.size` is not 1, or `bytes` is not valid UTF-8.
 NSTDAPI NSTDStrConst nstd_core_str_const_from_bytes(const NSTDSliceConst *bytes);
 
+/// Attempts to create a string slice from raw bytes.
+///
+/// Unlike `nstd_core_str_const_from_bytes` this will not panic if `bytes` is not valid UTF-8,
+/// making it suitable for validating untrusted input without unwinding across the FFI boundary.
+///
+/// # Parameters:
+///
+/// - `const NSTDSliceConst *bytes` - The UTF-8 encoded byte slice.
+///
+/// - `NSTDErrorCode *errc` - Set to nonzero if `bytes` is not valid UTF-8.
+///
+/// # Returns
+///
+/// `NSTDStrConst str` - The new string slice, or an empty string slice on error.
+///
+/// # Panics
+///
+/// This operation will panic if `bytes.ptr.size` is not 1.
+NSTDAPI NSTDStrConst nstd_core_str_const_try_from_bytes(const NSTDSliceConst *bytes,
+NSTDErrorCode *errc);
+
 /// Creates a string slice from raw bytes, without checking for UTF-8.
 ///
 /// # Parameters:
@@ -127,6 +156,37 @@ NSTDAPI NSTDUSize nstd_core_str_const_len(const NSTDStrConst *str);
 /// This operation could cause undefined behavior if `str`'s data is invalid.
 NSTDAPI NSTDUnichar nstd_core_str_const_get_char(const NSTDStrConst *str, NSTDUSize pos);
 
+/// Creates an iterator over the characters of a string slice.
+///
+/// # Parameters:
+///
+/// - `const NSTDStrConst *str` - The string slice to iterate over.
+///
+/// # Returns
+///
+/// `NSTDStrConstChars chars` - The new character iterator, referencing `str`'s data.
+NSTDAPI NSTDStrConstChars nstd_core_str_const_chars(const NSTDStrConst *str);
+
+/// Decodes the next character in a character iterator.
+///
+/// Characters are decoded forward in place without copying, allocating or re-validating the
+/// string slice's data, with a single-byte fast path for ASCII characters.
+///
+/// # Parameters:
+///
+/// - `NSTDStrConstChars *chars` - The character iterator.
+///
+/// - `NSTDUnichar *chr` - Returns as the decoded character.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero if the iterator has been exhausted.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if the iterator's string slice data is invalid.
+NSTDAPI NSTDErrorCode nstd_core_str_const_chars_next(NSTDStrConstChars *chars, NSTDUnichar *chr);
+
 /// Creates a substring of an existing string slice.
 ///
 /// # Note
@@ -155,6 +215,84 @@ NSTDAPI NSTDUnichar nstd_core_str_const_get_char(const NSTDStrConst *str, NSTDUS
 /// - The substring bytes are not valid UTF-8.
 NSTDAPI NSTDStrConst nstd_core_str_const_substr(const NSTDStrConst *str, NSTDURange range);
 
+/// Searches a string slice for the first occurrence of a pattern.
+///
+/// # Parameters:
+///
+/// - `const NSTDStrConst *str` - The string slice to search.
+///
+/// - `const NSTDStrConst *pattern` - The substring to search for.
+///
+/// - `NSTDErrorCode *errc` - Set to nonzero if `str` does not contain `pattern`.
+///
+/// # Returns
+///
+/// `NSTDURange range` - The byte range of the first match, suitable for
+/// `nstd_core_str_const_substr`, or an empty range on error.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `str` or `pattern`'s data is invalid.
+NSTDAPI NSTDURange nstd_core_str_const_find(const NSTDStrConst *str, const NSTDStrConst *pattern,
+NSTDErrorCode *errc);
+
+/// Searches a string slice for the last occurrence of a pattern.
+///
+/// # Parameters:
+///
+/// - `const NSTDStrConst *str` - The string slice to search.
+///
+/// - `const NSTDStrConst *pattern` - The substring to search for.
+///
+/// - `NSTDErrorCode *errc` - Set to nonzero if `str` does not contain `pattern`.
+///
+/// # Returns
+///
+/// `NSTDURange range` - The byte range of the last match, suitable for
+/// `nstd_core_str_const_substr`, or an empty range on error.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `str` or `pattern`'s data is invalid.
+NSTDAPI NSTDURange nstd_core_str_const_rfind(const NSTDStrConst *str, const NSTDStrConst *pattern,
+NSTDErrorCode *errc);
+
+/// Determines whether or not a string slice begins with a pattern.
+///
+/// # Parameters:
+///
+/// - `const NSTDStrConst *str` - The string slice to check.
+///
+/// - `const NSTDStrConst *pattern` - The substring to check for.
+///
+/// # Returns
+///
+/// `NSTDBool starts_with` - `NSTD_TRUE` if `str` begins with `pattern`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `str` or `pattern`'s data is invalid.
+NSTDAPI NSTDBool nstd_core_str_const_starts_with(const NSTDStrConst *str,
+const NSTDStrConst *pattern);
+
+/// Determines whether or not a string slice ends with a pattern.
+///
+/// # Parameters:
+///
+/// - `const NSTDStrConst *str` - The string slice to check.
+///
+/// - `const NSTDStrConst *pattern` - The substring to check for.
+///
+/// # Returns
+///
+/// `NSTDBool ends_with` - `NSTD_TRUE` if `str` ends with `pattern`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `str` or `pattern`'s data is invalid.
+NSTDAPI NSTDBool nstd_core_str_const_ends_with(const NSTDStrConst *str,
+const NSTDStrConst *pattern);
+
 /// Attempts to parse a string slice as an `NSTDFloat32`.
 ///
 /// # Parameters:
@@ -400,6 +538,26 @@ NSTDAPI NSTDStrMut nstd_core_str_mut_from_cstr_unchecked(NSTDCStrMut *cstr);
 /// This operation will panic if `bytes.ptr.size` is not 1, or `bytes` is not valid UTF-8.
 NSTDAPI NSTDStrMut nstd_core_str_mut_from_bytes(NSTDSliceMut *bytes);
 
+/// Attempts to create a string slice from raw bytes.
+///
+/// Unlike `nstd_core_str_mut_from_bytes` this will not panic if `bytes` is not valid UTF-8,
+/// making it suitable for validating untrusted input without unwinding across the FFI boundary.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *bytes` - The UTF-8 encoded byte slice.
+///
+/// - `NSTDErrorCode *errc` - Set to nonzero if `bytes` is not valid UTF-8.
+///
+/// # Returns
+///
+/// `NSTDStrMut str` - The new string slice, or an empty string slice on error.
+///
+/// # Panics
+///
+/// This operation will panic if `bytes.ptr.size` is not 1.
+NSTDAPI NSTDStrMut nstd_core_str_mut_try_from_bytes(NSTDSliceMut *bytes, NSTDErrorCode *errc);
+
 /// Creates a string slice from raw bytes, without checking for UTF-8.
 ///
 /// # Parameters:
@@ -65,7 +65,17 @@ NSTDAPI NSTDCString nstd_cstring_clone(const NSTDCString *cstring);
 /// # Returns
 ///
 /// `NSTDCStrConst cstr` - The new C string slice.
-NSTDAPI NSTDCStrConst nstd_cstring_as_cstr(const NSTDCString *cstring);
+///
+/// # Note
+///
+/// This function is implemented inline in the header so that C/C++ callers can avoid the
+/// cross-language call overhead in per-element loops.
+static inline NSTDCStrConst nstd_cstring_as_cstr(const NSTDCString *cstring) {
+    NSTDCStrConst cstr;
+    cstr.ptr = (const NSTDChar *)cstring->bytes.buffer.ptr.raw;
+    cstr.len = cstring->bytes.len;
+    return cstr;
+}
 
 /// Creates a C string slice containing the contents of `cstring`.
 ///
@@ -0,0 +1,201 @@
+#ifndef NSTD_HASH_MAP_H_INCLUDED
+#define NSTD_HASH_MAP_H_INCLUDED
+#include "core/def.h"
+#include "nstd.h"
+NSTDCPPSTART
+
+/// A function to be called for each entry in a hash map.
+///
+/// The first parameter is a pointer to the entry's key, the second parameter is a pointer to the
+/// entry's value and the third parameter is the user data that was passed along with the
+/// function.
+typedef void (*NSTDHashMapForEach)(NSTDAnyConst, NSTDAnyMut, NSTDAnyMut);
+
+/// An unordered associative container with untyped keys and values.
+typedef struct {
+    /// A pointer to the map's bucket buffer.
+    NSTDAnyMut buffer;
+    /// The size in bytes of the map's keys.
+    NSTDUSize key_size;
+    /// The size in bytes of the map's values.
+    NSTDUSize value_size;
+    /// The number of buckets in the map's bucket buffer.
+    NSTDUSize cap;
+    /// The number of entries in the map.
+    NSTDUSize len;
+    /// The number of buckets holding a removed entry's tombstone.
+    NSTDUSize tombstones;
+} NSTDHashMap;
+
+/// Creates a new hash map without allocating any resources.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize key_size` - The size in bytes of the map's keys.
+///
+/// - `NSTDUSize value_size` - The size in bytes of the map's values.
+///
+/// # Returns
+///
+/// `NSTDHashMap map` - The new hash map.
+///
+/// # Panics
+///
+/// This function will panic if either `key_size` or `value_size` are zero.
+NSTDAPI NSTDHashMap nstd_hash_map_new(NSTDUSize key_size, NSTDUSize value_size);
+
+/// Creates a new hash map initialized with the given capacity.
+///
+/// # Note
+///
+/// This will return a map without any allocated buckets on error.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize key_size` - The size in bytes of the map's keys.
+///
+/// - `NSTDUSize value_size` - The size in bytes of the map's values.
+///
+/// - `NSTDUSize cap` - The number of entries to preallocate space for.
+///
+/// # Returns
+///
+/// `NSTDHashMap map` - The new hash map.
+///
+/// # Panics
+///
+/// This function will panic if either `key_size`, `value_size`, or `cap` are zero.
+NSTDAPI NSTDHashMap nstd_hash_map_new_with_cap(NSTDUSize key_size, NSTDUSize value_size,
+NSTDUSize cap);
+
+/// Returns the number of entries in a hash map.
+///
+/// # Parameters:
+///
+/// - `const NSTDHashMap *map` - The hash map.
+///
+/// # Returns
+///
+/// `NSTDUSize len` - The number of entries in the hash map.
+NSTDAPI NSTDUSize nstd_hash_map_len(const NSTDHashMap *map);
+
+/// Inserts an entry into a hash map, overwriting the previous value if the map already contained
+/// the entry's key.
+///
+/// # Parameters:
+///
+/// - `NSTDHashMap *map` - The hash map.
+///
+/// - `NSTDAnyConst key` - A pointer to the entry's key.
+///
+/// - `NSTDAnyConst value` - A pointer to the entry's value.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero if allocating for the map's bucket buffer fails.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if the sizes of the key and value being inserted
+/// do not match `map`'s key and value sizes.
+NSTDAPI NSTDErrorCode nstd_hash_map_insert(NSTDHashMap *map, NSTDAnyConst key, NSTDAnyConst value);
+
+/// Returns an immutable pointer to the value of the entry with key `key` in `map`.
+///
+/// # Note
+///
+/// It is highly advised to copy the return value onto the stack because the pointer can easily
+/// become invalid if the map is mutated.
+///
+/// # Parameters:
+///
+/// - `const NSTDHashMap *map` - The hash map.
+///
+/// - `NSTDAnyConst key` - A pointer to the key of the entry to retrieve.
+///
+/// # Returns
+///
+/// `NSTDAnyConst value` - A pointer to the entry's value, or null if the map does not contain
+/// `key`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if the size of the key does not match `map`'s key
+/// size.
+NSTDAPI NSTDAnyConst nstd_hash_map_get(const NSTDHashMap *map, NSTDAnyConst key);
+
+/// Returns a pointer to the value of the entry with key `key` in `map`.
+///
+/// # Note
+///
+/// It is highly advised to copy the return value onto the stack because the pointer can easily
+/// become invalid if the map is mutated.
+///
+/// # Parameters:
+///
+/// - `NSTDHashMap *map` - The hash map.
+///
+/// - `NSTDAnyConst key` - A pointer to the key of the entry to retrieve.
+///
+/// # Returns
+///
+/// `NSTDAnyMut value` - A pointer to the entry's value, or null if the map does not contain
+/// `key`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if the size of the key does not match `map`'s key
+/// size.
+NSTDAPI NSTDAnyMut nstd_hash_map_get_mut(NSTDHashMap *map, NSTDAnyConst key);
+
+/// Removes the entry with key `key` from a hash map.
+///
+/// # Parameters:
+///
+/// - `NSTDHashMap *map` - The hash map.
+///
+/// - `NSTDAnyConst key` - A pointer to the key of the entry to remove.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero if the map does not contain `key`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if the size of the key does not match `map`'s key
+/// size.
+NSTDAPI NSTDErrorCode nstd_hash_map_remove(NSTDHashMap *map, NSTDAnyConst key);
+
+/// Calls `callback` with the key and value of each entry in a hash map.
+///
+/// The order in which the entries are visited is unspecified.
+///
+/// # Parameters:
+///
+/// - `NSTDHashMap *map` - The hash map.
+///
+/// - `NSTDHashMapForEach callback` - The function to call for each entry in the map.
+///
+/// - `NSTDAnyMut ctx` - User data to pass to the callback on each call.
+///
+/// # Safety
+///
+/// The callback must not insert into or remove from the map.
+NSTDAPI void nstd_hash_map_for_each(NSTDHashMap *map, NSTDHashMapForEach callback, NSTDAnyMut ctx);
+
+/// Removes all entries from a hash map, keeping it's bucket buffer.
+///
+/// # Parameters:
+///
+/// - `NSTDHashMap *map` - The hash map to clear.
+NSTDAPI void nstd_hash_map_clear(NSTDHashMap *map);
+
+/// Frees an instance of `NSTDHashMap`.
+///
+/// # Parameters:
+///
+/// - `NSTDHashMap map` - The hash map to free.
+NSTDAPI void nstd_hash_map_free(NSTDHashMap map);
+
+NSTDCPPEND
+#endif
@@ -2,6 +2,7 @@
 #define NSTD_HEAP_PTR_H_INCLUDED
 #include "core/ptr.h"
 #include "nstd.h"
+#include "vec.h"
 NSTDCPPSTART
 
 /// A pointer type for single value heap allocation.
@@ -61,6 +62,56 @@ NSTDAPI NSTDHeapPtr nstd_heap_ptr_new_zeroed(NSTDUSize element_size);
 /// This function will panic if allocation fails.
 NSTDAPI NSTDHeapPtr nstd_heap_ptr_clone(const NSTDHeapPtr *hptr);
 
+/// Takes ownership of a heap object's allocation, leaving the original heap pointer empty.
+///
+/// This transfers the payload without allocating or copying. The emptied heap pointer no longer
+/// owns an object (it's size becomes zero and it's data becomes null), but it may still be safely
+/// freed.
+///
+/// # Parameters:
+///
+/// - `NSTDHeapPtr *hptr` - The heap pointer to take the allocation from.
+///
+/// # Returns
+///
+/// `NSTDHeapPtr taken` - A new heap pointer that owns the allocation.
+NSTDAPI NSTDHeapPtr nstd_heap_ptr_take(NSTDHeapPtr *hptr);
+
+/// Returns ownership of an `NSTDHeapPtr`'s allocation as a byte vector, taking ownership of said
+/// heap pointer.
+///
+/// This transfers the payload without allocating or copying, the returned vector reuses the heap
+/// object's buffer.
+///
+/// # Parameters:
+///
+/// - `NSTDHeapPtr hptr` - The heap pointer.
+///
+/// # Returns
+///
+/// `NSTDVec bytes` - A byte vector that owns the heap object's data.
+NSTDAPI NSTDVec nstd_heap_ptr_into_vec(NSTDHeapPtr hptr);
+
+/// Returns ownership of a vector's buffer as a heap object, taking ownership of said vector.
+///
+/// The vector's buffer is shrunk to match it's active length and handed to the heap pointer
+/// without copying. The size of the returned heap object is the vector's length in bytes.
+///
+/// # Parameters:
+///
+/// - `NSTDVec vec` - The vector.
+///
+/// # Returns
+///
+/// `NSTDHeapPtr hptr` - A heap object that owns the vector's data, or an empty heap pointer if
+/// `vec` is a "null vector".
+///
+/// # Panics
+///
+/// This operation will panic if `vec`'s buffer is aligned above one byte or shrinking the buffer
+/// fails.
+NSTDAPI NSTDHeapPtr nstd_vec_into_heap_ptr(NSTDVec vec);
+
 /// Returns the size of the heap allocated object.
 ///
 /// # Parameters:
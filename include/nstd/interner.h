@@ -0,0 +1,89 @@
+#ifndef NSTD_INTERNER_H_INCLUDED
+#define NSTD_INTERNER_H_INCLUDED
+#include "core/def.h"
+#include "core/str.h"
+#include "nstd.h"
+#include "vec.h"
+NSTDCPPSTART
+
+/// A deduplicating string pool.
+typedef struct {
+    /// The list of slabs holding the interned strings' bytes.
+    NSTDVec slabs;
+    /// Each interned string's view, indexed by it's id.
+    NSTDVec views;
+    /// The hash table mapping string hashes to ids, each slot holds an id plus one or 0 if the
+    /// slot is empty.
+    NSTDAnyMut table;
+    /// The number of slots in the hash table, always a power of two.
+    NSTDUSize table_cap;
+} NSTDInterner;
+
+/// Creates a new empty string interner.
+///
+/// # Returns
+///
+/// `NSTDInterner interner` - The new string interner.
+NSTDAPI NSTDInterner nstd_interner_new();
+
+/// Returns the number of unique strings in an interner.
+///
+/// # Parameters:
+///
+/// - `const NSTDInterner *interner` - The string interner.
+///
+/// # Returns
+///
+/// `NSTDUSize len` - The number of unique strings in the interner.
+NSTDAPI NSTDUSize nstd_interner_len(const NSTDInterner *interner);
+
+/// Interns a string, returning it's id.
+///
+/// If the interner already contains `str` this is a hash lookup that never allocates and the
+/// existing id is returned, so two interned strings are equal if and only if their ids are equal.
+/// Otherwise the string's bytes are copied into one of the interner's slabs and a new id is
+/// created.
+///
+/// # Parameters:
+///
+/// - `NSTDInterner *interner` - The string interner.
+///
+/// - `const NSTDStrConst *str` - The string to intern.
+///
+/// - `NSTDErrorCode *errc` - Set to nonzero on allocation failure.
+///
+/// # Returns
+///
+/// `NSTDUSize id` - The interned string's id.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `str`'s data is invalid.
+NSTDAPI NSTDUSize nstd_interner_intern(NSTDInterner *interner, const NSTDStrConst *str,
+NSTDErrorCode *errc);
+
+/// Returns the stable string view with id `id`.
+///
+/// The view's data lives in the interner's slabs and remains valid for the interner's lifetime.
+///
+/// # Parameters:
+///
+/// - `const NSTDInterner *interner` - The string interner.
+///
+/// - `NSTDUSize id` - The id of the string to get.
+///
+/// # Returns
+///
+/// `NSTDStrConst str` - The interned string with id `id`, or an empty string slice if `id` is
+/// not a valid id.
+NSTDAPI NSTDStrConst nstd_interner_get(const NSTDInterner *interner, NSTDUSize id);
+
+/// Frees an instance of `NSTDInterner`, invalidating all of it's string views.
+///
+/// # Parameters:
+///
+/// - `NSTDInterner interner` - The string interner to free.
+NSTDAPI void nstd_interner_free(NSTDInterner interner);
+
+NSTDCPPEND
+#endif
@@ -1,5 +1,6 @@
 #ifndef NSTD_OS_H_INCLUDED
 #define NSTD_OS_H_INCLUDED
 #include "nstd.h"
+#include "os/unix.h"
 #include "os/windows.h"
 #endif
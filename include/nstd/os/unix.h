@@ -0,0 +1,5 @@
+#ifndef NSTD_OS_UNIX_H_INCLUDED
+#define NSTD_OS_UNIX_H_INCLUDED
+#include "../nstd.h"
+#include "unix/mmap.h"
+#endif
@@ -0,0 +1,81 @@
+#ifndef NSTD_OS_UNIX_MMAP_H_INCLUDED
+#define NSTD_OS_UNIX_MMAP_H_INCLUDED
+#include "../../core/def.h"
+#include "../../core/slice.h"
+#include "../../nstd.h"
+NSTDCPPSTART
+
+/// Describes how a memory mapped file view is expected to be accessed.
+typedef enum {
+    /// No special access pattern, the operating system's default behavior.
+    NSTD_UNIX_MMAP_ADVICE_NORMAL,
+    /// The view will be read from start to finish, read-ahead may be increased.
+    NSTD_UNIX_MMAP_ADVICE_SEQUENTIAL,
+    /// The view will be accessed in a random order, read-ahead may be useless.
+    NSTD_UNIX_MMAP_ADVICE_RANDOM,
+    /// The view will be needed soon, pages may be read ahead of time.
+    NSTD_UNIX_MMAP_ADVICE_WILL_NEED,
+    /// The view will not be needed soon, pages may be released.
+    NSTD_UNIX_MMAP_ADVICE_DONT_NEED
+} NSTDUnixMmapAdvice;
+
+/// Creates a read-only memory mapped view over the contents of the file at `path`.
+///
+/// The view is backed directly by the operating system's page cache, no copy of the file's
+/// contents is made. The view must be unmapped with `nstd_os_unix_mmap_unmap` once it is no longer
+/// in use.
+///
+/// # Parameters:
+///
+/// - `const NSTDChar *path` - A path to the file to map.
+///
+/// # Returns
+///
+/// `NSTDSliceConst view` - A byte slice view over the file's contents. The view will be empty if
+/// the file is empty or mapping fails.
+///
+/// # Safety
+///
+/// - `path` must point to a null terminated C string.
+///
+/// - The view is invalidated if the file is truncated while it is mapped.
+NSTDAPI NSTDSliceConst nstd_os_unix_mmap_map(const NSTDChar *path);
+
+/// Advises the operating system on how a memory mapped file view is expected to be accessed.
+///
+/// This is purely a performance hint, a view behaves identically with or without it.
+///
+/// # Parameters:
+///
+/// - `const NSTDSliceConst *view` - The memory mapped file view.
+///
+/// - `NSTDUnixMmapAdvice advice` - The expected access pattern.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero if the operating system rejected the hint.
+///
+/// # Safety
+///
+/// `view` must be a view returned by `nstd_os_unix_mmap_map` that has not yet been unmapped.
+NSTDAPI NSTDErrorCode nstd_os_unix_mmap_advise(const NSTDSliceConst *view,
+NSTDUnixMmapAdvice advice);
+
+/// Unmaps a memory mapped file view.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceConst view` - The memory mapped file view to unmap.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// `view` must be a view returned by `nstd_os_unix_mmap_map`. The view's data must not be accessed
+/// after this function is called.
+NSTDAPI NSTDErrorCode nstd_os_unix_mmap_unmap(NSTDSliceConst view);
+
+NSTDCPPEND
+#endif
@@ -2,4 +2,5 @@
 #define NSTD_OS_WINDOWS_H_INCLUDED
 #include "../nstd.h"
 #include "windows/alloc.h"
+#include "windows/mmap.h"
 #endif
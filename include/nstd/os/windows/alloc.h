@@ -4,7 +4,67 @@
 #include "../../nstd.h"
 NSTDCPPSTART
 
-/// Allocates a new block of memory on the current process' heap.
+/// A handle to a Windows heap.
+typedef NSTDISize NSTDWindowsHeapHandle;
+
+/// Creates a new private heap.
+///
+/// The heap grows as needed. When `no_serialize` is true the heap's operations are not serialized
+/// by a lock, in this case the heap must only be used from one thread at a time.
+///
+/// # Parameters:
+///
+/// - `NSTDBool no_serialize` - `NSTD_TRUE` to skip lock serialization for thread-confined heaps.
+///
+/// # Returns
+///
+/// `NSTDWindowsHeapHandle heap` - A handle to the new heap, 0 on error.
+///
+/// # Safety
+///
+/// See <https://docs.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapcreate>.
+NSTDAPI NSTDWindowsHeapHandle nstd_os_windows_alloc_heap_new(NSTDBool no_serialize);
+
+/// Destroys a private heap, invalidating every block allocated from it.
+///
+/// # Parameters:
+///
+/// - `NSTDWindowsHeapHandle *heap` - The heap to destroy.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// See <https://docs.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapdestroy>.
+NSTDAPI NSTDErrorCode nstd_os_windows_alloc_heap_free(NSTDWindowsHeapHandle *heap);
+
+/// Routes the calling thread's allocations through `heap`.
+///
+/// Until the next call to this function on the same thread, the `nstd_os_windows_alloc_*`
+/// functions (and everything built on them, such as `NSTDVec` growth) use `heap` instead of the
+/// process default heap. Pass 0 to restore the process default heap.
+///
+/// # Parameters:
+///
+/// - `NSTDWindowsHeapHandle heap` - The heap to route the calling thread's allocations through.
+///
+/// # Returns
+///
+/// `NSTDWindowsHeapHandle prev` - The previous override, 0 if none was set.
+///
+/// # Panics
+///
+/// This function will panic if the operating system runs out of TLS indexes.
+///
+/// # Safety
+///
+/// Memory must be deallocated through the same heap it was allocated from, the caller is
+/// responsible for restoring the previous heap before freeing memory that was allocated under it.
+NSTDAPI NSTDWindowsHeapHandle nstd_os_windows_alloc_set_heap(NSTDWindowsHeapHandle heap);
+
+/// Allocates a new block of memory on the calling thread's heap.
 ///
 /// # Parameters:
 ///
@@ -19,7 +79,7 @@ NSTDCPPSTART
 /// See <https://docs.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapalloc>.
 NSTDAPI NSTDAnyMut nstd_os_windows_alloc_allocate(NSTDUSize size);
 
-/// Allocates a new block of zero-initialized memory on the current process' heap.
+/// Allocates a new block of zero-initialized memory on the calling thread's heap.
 ///
 /// # Parameters:
 ///
@@ -72,5 +132,82 @@ NSTDAPI NSTDErrorCode nstd_os_windows_alloc_reallocate(NSTDAnyMut *ptr, NSTDUSiz
 /// See <https://docs.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapfree>.
 NSTDAPI NSTDErrorCode nstd_os_windows_alloc_deallocate(NSTDAnyMut *ptr);
 
+/// Allocates a new block of memory on `heap`.
+///
+/// # Parameters:
+///
+/// - `NSTDWindowsHeapHandle heap` - The heap to allocate from.
+///
+/// - `NSTDUSize size` - The number of bytes to allocate.
+///
+/// # Returns
+///
+/// `NSTDAnyMut ptr` - A pointer to the block of memory, null on error.
+///
+/// # Safety
+///
+/// See <https://docs.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapalloc>.
+NSTDAPI NSTDAnyMut nstd_os_windows_alloc_heap_allocate(NSTDWindowsHeapHandle heap, NSTDUSize size);
+
+/// Allocates a new block of zero-initialized memory on `heap`.
+///
+/// # Parameters:
+///
+/// - `NSTDWindowsHeapHandle heap` - The heap to allocate from.
+///
+/// - `NSTDUSize size` - The number of bytes to allocate.
+///
+/// # Returns
+///
+/// `NSTDAnyMut ptr` - A pointer to the block of memory, null on error.
+///
+/// # Safety
+///
+/// See <https://docs.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapalloc>.
+NSTDAPI NSTDAnyMut nstd_os_windows_alloc_heap_allocate_zeroed(NSTDWindowsHeapHandle heap,
+NSTDUSize size);
+
+/// Reallocates a block of memory previously allocated on `heap`.
+///
+/// If everything goes right, the pointer will point to the new memory location and 0 will be
+/// returned. If this is not the case and allocation fails, the pointer will remain untouched and a
+/// value of nonzero is returned.
+///
+/// # Parameters:
+///
+/// - `NSTDWindowsHeapHandle heap` - The heap the memory was allocated from.
+///
+/// - `NSTDAnyMut *ptr` - A pointer to the allocated memory.
+///
+/// - `NSTDUSize new_size` - The number of bytes to reallocate.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// See <https://docs.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heaprealloc>.
+NSTDAPI NSTDErrorCode nstd_os_windows_alloc_heap_reallocate(NSTDWindowsHeapHandle heap,
+NSTDAnyMut *ptr, NSTDUSize new_size);
+
+/// Deallocates a block of memory previously allocated on `heap`.
+///
+/// # Parameters:
+///
+/// - `NSTDWindowsHeapHandle heap` - The heap the memory was allocated from.
+///
+/// - `NSTDAnyMut *ptr` - A pointer to the allocated memory.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// See <https://docs.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapfree>.
+NSTDAPI NSTDErrorCode nstd_os_windows_alloc_heap_deallocate(NSTDWindowsHeapHandle heap,
+NSTDAnyMut *ptr);
+
 NSTDCPPEND
 #endif
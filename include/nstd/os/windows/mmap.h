@@ -0,0 +1,44 @@
+#ifndef NSTD_OS_WINDOWS_MMAP_H_INCLUDED
+#define NSTD_OS_WINDOWS_MMAP_H_INCLUDED
+#include "../../core/def.h"
+#include "../../core/slice.h"
+#include "../../nstd.h"
+NSTDCPPSTART
+
+/// Creates a read-only memory mapped view over the contents of the file at `path`.
+///
+/// The view is backed directly by the operating system's page cache, no copy of the file's
+/// contents is made. The view must be unmapped with `nstd_os_windows_mmap_unmap` once it is no
+/// longer in use.
+///
+/// # Parameters:
+///
+/// - `const NSTDChar *path` - A path to the file to map.
+///
+/// # Returns
+///
+/// `NSTDSliceConst view` - A byte slice view over the file's contents. The view will be empty if
+/// the file is empty or mapping fails.
+///
+/// # Safety
+///
+/// See <https://docs.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-mapviewoffile>.
+NSTDAPI NSTDSliceConst nstd_os_windows_mmap_map(const NSTDChar *path);
+
+/// Unmaps a memory mapped file view.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceConst view` - The memory mapped file view to unmap.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// See <https://docs.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-unmapviewoffile>.
+NSTDAPI NSTDErrorCode nstd_os_windows_mmap_unmap(NSTDSliceConst view);
+
+NSTDCPPEND
+#endif
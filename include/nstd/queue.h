@@ -0,0 +1,112 @@
+#ifndef NSTD_QUEUE_H_INCLUDED
+#define NSTD_QUEUE_H_INCLUDED
+#include "core/def.h"
+#include "nstd.h"
+NSTDCPPSTART
+
+/// A bounded lock-free multi-producer multi-consumer queue.
+typedef struct {
+    /// A pointer to the ring buffer's slots.
+    ///
+    /// Each slot stores it's sequence number followed by the element's bytes and is padded out to
+    /// a cache line multiple.
+    NSTDAnyMut buffer;
+    /// The number of slots in the ring buffer, always a power of two.
+    NSTDUSize cap;
+    /// The size in bytes of each element in the queue.
+    NSTDUSize element_size;
+    /// The size in bytes of each slot in the ring buffer.
+    NSTDUSize stride;
+    /// Padding to keep the enqueue position on it's own cache line.
+    NSTDByte pad0[64 - sizeof(NSTDUSize)];
+    /// The position the next element will be pushed at.
+    NSTDUSize push_pos;
+    /// Padding to keep the dequeue position on it's own cache line.
+    NSTDByte pad1[64 - sizeof(NSTDUSize)];
+    /// The position the next element will be popped from.
+    NSTDUSize pop_pos;
+} NSTDQueue;
+
+/// Creates a new queue with room for at least `cap` elements.
+///
+/// The capacity is rounded up to the next power of two.
+///
+/// # Note
+///
+/// This will return a "null queue" (a queue with no buffer) on error.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize element_size` - The size in bytes of each element in the queue.
+///
+/// - `NSTDUSize cap` - The minimum number of elements the queue can hold.
+///
+/// # Returns
+///
+/// `NSTDQueue queue` - The new queue.
+///
+/// # Panics
+///
+/// This function will panic if either `element_size` or `cap` are zero.
+NSTDAPI NSTDQueue nstd_queue_new(NSTDUSize element_size, NSTDUSize cap);
+
+/// Returns the number of elements a queue can hold.
+///
+/// # Parameters:
+///
+/// - `const NSTDQueue *queue` - The queue.
+///
+/// # Returns
+///
+/// `NSTDUSize cap` - The queue's capacity.
+NSTDAPI NSTDUSize nstd_queue_cap(const NSTDQueue *queue);
+
+/// Attempts to push a value onto the end of a queue without blocking.
+///
+/// This operation is safe to call from any number of threads at once and never takes a lock.
+///
+/// # Parameters:
+///
+/// - `const NSTDQueue *queue` - The queue.
+///
+/// - `NSTDAnyConst value` - A pointer to the value to push onto the queue.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero if the queue is full.
+///
+/// # Safety
+///
+/// This operation is unsafe because undefined behaviour can occur if the size of the value being
+/// pushed onto the queue is not equal to the queue's element size.
+NSTDAPI NSTDErrorCode nstd_queue_try_push(const NSTDQueue *queue, NSTDAnyConst value);
+
+/// Attempts to pop a value off of the front of a queue without blocking.
+///
+/// This operation is safe to call from any number of threads at once and never takes a lock.
+///
+/// # Parameters:
+///
+/// - `const NSTDQueue *queue` - The queue.
+///
+/// - `NSTDAnyMut value` - A pointer to the memory to receive the popped value.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero if the queue is empty.
+///
+/// # Safety
+///
+/// This operation is unsafe because undefined behaviour can occur if `value`'s size is not equal
+/// to the queue's element size.
+NSTDAPI NSTDErrorCode nstd_queue_try_pop(const NSTDQueue *queue, NSTDAnyMut value);
+
+/// Frees an instance of `NSTDQueue`.
+///
+/// # Parameters:
+///
+/// - `NSTDQueue queue` - The queue to free.
+NSTDAPI void nstd_queue_free(NSTDQueue queue);
+
+NSTDCPPEND
+#endif
@@ -97,5 +97,110 @@ NSTDAPI NSTDAnyConst nstd_shared_ptr_get(const NSTDSharedPtr *shared_ptr);
 /// - `NSTDSharedPtr shared_ptr` - The shared object to free.
 NSTDAPI void nstd_shared_ptr_free(NSTDSharedPtr shared_ptr);
 
+/// An atomically reference counting smart pointer.
+///
+/// Unlike `NSTDSharedPtr`, instances of this type may be shared across and freed from different
+/// threads, making it suitable for sharing immutable data across a thread pool with a single
+/// allocation.
+typedef struct {
+    /// A pointer to private data about the shared object.
+    NSTDPtrMut ptr;
+} NSTDSharedPtrAtomic;
+
+/// Creates a new initialized instance of an atomically reference counted shared pointer.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize element_size` - The size of the shared object.
+///
+/// - `NSTDAnyConst init` - A pointer to the object to initialize the shared pointer with.
+///
+/// # Returns
+///
+/// `NSTDSharedPtrAtomic shared_ptr` - The new shared pointer.
+///
+/// # Panics
+///
+/// This operation will panic if allocating fails.
+///
+/// # Safety
+///
+/// This operation is unsafe because passing `init` as a null pointer can cause undefined behavior.
+NSTDAPI NSTDSharedPtrAtomic nstd_shared_ptr_atomic_new(NSTDUSize element_size, NSTDAnyConst init);
+
+/// Creates a new zero-initialized instance of an atomically reference counted shared pointer.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize element_size` - The size of the shared object.
+///
+/// # Returns
+///
+/// `NSTDSharedPtrAtomic shared_ptr` - The yet to be shared pointer.
+///
+/// # Panics
+///
+/// This operation will panic if allocating fails.
+NSTDAPI NSTDSharedPtrAtomic nstd_shared_ptr_atomic_new_zeroed(NSTDUSize element_size);
+
+/// Shares `shared_ptr`.
+///
+/// The pointer count is updated atomically, so the new instance may be handed off to another
+/// thread.
+///
+/// # Parameters:
+///
+/// - `const NSTDSharedPtrAtomic *shared_ptr` - The shared object to share.
+///
+/// # Returns
+///
+/// `NSTDSharedPtrAtomic shared` - A new pointer pointing to the shared data.
+NSTDAPI NSTDSharedPtrAtomic nstd_shared_ptr_atomic_share(const NSTDSharedPtrAtomic *shared_ptr);
+
+/// Returns the number pointers that share `shared_ptr`'s data.
+///
+/// # Parameters:
+///
+/// - `const NSTDSharedPtrAtomic *shared_ptr` - An instance of a shared pointer.
+///
+/// # Returns
+///
+/// `NSTDUSize owners` - The number pointers that share `shared_ptr`'s data.
+NSTDAPI NSTDUSize nstd_shared_ptr_atomic_owners(const NSTDSharedPtrAtomic *shared_ptr);
+
+/// Returns the size of the shared object.
+///
+/// # Note
+///
+/// The returned size is rounded up to the alignment of the pointer count, so it may be slightly
+/// greater than the size the shared pointer was created with.
+///
+/// # Parameters:
+///
+/// - `const NSTDSharedPtrAtomic *shared_ptr` - The shared pointer.
+///
+/// # Returns
+///
+/// `NSTDUSize size` - The size of the shared object.
+NSTDAPI NSTDUSize nstd_shared_ptr_atomic_size(const NSTDSharedPtrAtomic *shared_ptr);
+
+/// Returns an immutable raw pointer to the shared object.
+///
+/// # Parameters:
+///
+/// - `const NSTDSharedPtrAtomic *shared_ptr` - The shared pointer.
+///
+/// # Returns
+///
+/// `NSTDAnyConst ptr` - A raw pointer to the shared object.
+NSTDAPI NSTDAnyConst nstd_shared_ptr_atomic_get(const NSTDSharedPtrAtomic *shared_ptr);
+
+/// Frees an instance of `NSTDSharedPtrAtomic`.
+///
+/// # Parameters:
+///
+/// - `NSTDSharedPtrAtomic shared_ptr` - The shared object to free.
+NSTDAPI void nstd_shared_ptr_atomic_free(NSTDSharedPtrAtomic shared_ptr);
+
 NSTDCPPEND
 #endif
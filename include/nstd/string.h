@@ -1,5 +1,6 @@
 #ifndef NSTD_STRING_H_INCLUDED
 #define NSTD_STRING_H_INCLUDED
+#include "core/cstr.h"
 #include "core/def.h"
 #include "core/slice.h"
 #include "core/str.h"
@@ -124,6 +125,252 @@ NSTDAPI NSTDErrorCode nstd_string_push(NSTDString *string, NSTDUnichar chr);
 /// This function will cause undefined behavior in the case where `str`'s data is no longer valid.
 NSTDAPI NSTDErrorCode nstd_string_push_str(NSTDString *string, const NSTDStrConst *str);
 
+/// Appends a UTF-8 encoded C string slice to the end of a string.
+///
+/// # Parameters:
+///
+/// - `NSTDString *string` - The string.
+///
+/// - `const NSTDCStrConst *cstr` - The C string slice to append to the end of `string`.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Possible errors
+///
+/// - `1` - `cstr`'s data is not valid UTF-8.
+///
+/// - `2` - Reserving memory for the push fails.
+///
+/// # Safety
+///
+/// This function will cause undefined behavior in the case where `cstr`'s data is no longer valid.
+NSTDAPI NSTDErrorCode nstd_string_push_cstr(NSTDString *string, const NSTDCStrConst *cstr);
+
+/// Appends a signed integer's base-10 representation to the end of a string.
+///
+/// The integer's digits are written directly into the string's buffer after a single reserve.
+///
+/// # Parameters:
+///
+/// - `NSTDString *string` - The string.
+///
+/// - `NSTDInt64 v` - The signed integer to append to the string.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+NSTDAPI NSTDErrorCode nstd_string_push_int(NSTDString *string, NSTDInt64 v);
+
+/// Appends an unsigned integer's base-10 representation to the end of a string.
+///
+/// The integer's digits are written directly into the string's buffer after a single reserve.
+///
+/// # Parameters:
+///
+/// - `NSTDString *string` - The string.
+///
+/// - `NSTDUInt64 v` - The unsigned integer to append to the string.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+NSTDAPI NSTDErrorCode nstd_string_push_uint(NSTDString *string, NSTDUInt64 v);
+
+/// Appends a floating point value's decimal representation to the end of a string.
+///
+/// # Parameters:
+///
+/// - `NSTDString *string` - The string.
+///
+/// - `NSTDFloat64 v` - The floating point value to append to the string.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+NSTDAPI NSTDErrorCode nstd_string_push_float(NSTDString *string, NSTDFloat64 v);
+
+/// Creates a new string containing the decimal representation of an `NSTDFloat32`.
+///
+/// # Note
+///
+/// It is possible for this function to return an empty string if allocating fails.
+///
+/// # Parameters:
+///
+/// - `NSTDFloat32 v` - The 32-bit floating-point value.
+///
+/// # Returns
+///
+/// `NSTDString string` - The new string.
+NSTDAPI NSTDString nstd_string_from_f32(NSTDFloat32 v);
+
+/// Creates a new string containing the decimal representation of an `NSTDFloat64`.
+///
+/// # Note
+///
+/// It is possible for this function to return an empty string if allocating fails.
+///
+/// # Parameters:
+///
+/// - `NSTDFloat64 v` - The 64-bit floating-point value.
+///
+/// # Returns
+///
+/// `NSTDString string` - The new string.
+NSTDAPI NSTDString nstd_string_from_f64(NSTDFloat64 v);
+
+/// Creates a new string containing the base-10 representation of an `NSTDUInt8`.
+///
+/// # Note
+///
+/// It is possible for this function to return an empty string if allocating fails.
+///
+/// # Parameters:
+///
+/// - `NSTDUInt8 v` - The 8-bit unsigned integer.
+///
+/// # Returns
+///
+/// `NSTDString string` - The new string.
+NSTDAPI NSTDString nstd_string_from_u8(NSTDUInt8 v);
+
+/// Creates a new string containing the base-10 representation of an `NSTDInt8`.
+///
+/// # Note
+///
+/// It is possible for this function to return an empty string if allocating fails.
+///
+/// # Parameters:
+///
+/// - `NSTDInt8 v` - The 8-bit signed integer.
+///
+/// # Returns
+///
+/// `NSTDString string` - The new string.
+NSTDAPI NSTDString nstd_string_from_i8(NSTDInt8 v);
+
+/// Creates a new string containing the base-10 representation of an `NSTDUInt16`.
+///
+/// # Note
+///
+/// It is possible for this function to return an empty string if allocating fails.
+///
+/// # Parameters:
+///
+/// - `NSTDUInt16 v` - The 16-bit unsigned integer.
+///
+/// # Returns
+///
+/// `NSTDString string` - The new string.
+NSTDAPI NSTDString nstd_string_from_u16(NSTDUInt16 v);
+
+/// Creates a new string containing the base-10 representation of an `NSTDInt16`.
+///
+/// # Note
+///
+/// It is possible for this function to return an empty string if allocating fails.
+///
+/// # Parameters:
+///
+/// - `NSTDInt16 v` - The 16-bit signed integer.
+///
+/// # Returns
+///
+/// `NSTDString string` - The new string.
+NSTDAPI NSTDString nstd_string_from_i16(NSTDInt16 v);
+
+/// Creates a new string containing the base-10 representation of an `NSTDUInt32`.
+///
+/// # Note
+///
+/// It is possible for this function to return an empty string if allocating fails.
+///
+/// # Parameters:
+///
+/// - `NSTDUInt32 v` - The 32-bit unsigned integer.
+///
+/// # Returns
+///
+/// `NSTDString string` - The new string.
+NSTDAPI NSTDString nstd_string_from_u32(NSTDUInt32 v);
+
+/// Creates a new string containing the base-10 representation of an `NSTDInt32`.
+///
+/// # Note
+///
+/// It is possible for this function to return an empty string if allocating fails.
+///
+/// # Parameters:
+///
+/// - `NSTDInt32 v` - The 32-bit signed integer.
+///
+/// # Returns
+///
+/// `NSTDString string` - The new string.
+NSTDAPI NSTDString nstd_string_from_i32(NSTDInt32 v);
+
+/// Creates a new string containing the base-10 representation of an `NSTDUInt64`.
+///
+/// # Note
+///
+/// It is possible for this function to return an empty string if allocating fails.
+///
+/// # Parameters:
+///
+/// - `NSTDUInt64 v` - The 64-bit unsigned integer.
+///
+/// # Returns
+///
+/// `NSTDString string` - The new string.
+NSTDAPI NSTDString nstd_string_from_u64(NSTDUInt64 v);
+
+/// Creates a new string containing the base-10 representation of an `NSTDInt64`.
+///
+/// # Note
+///
+/// It is possible for this function to return an empty string if allocating fails.
+///
+/// # Parameters:
+///
+/// - `NSTDInt64 v` - The 64-bit signed integer.
+///
+/// # Returns
+///
+/// `NSTDString string` - The new string.
+NSTDAPI NSTDString nstd_string_from_i64(NSTDInt64 v);
+
+/// Creates a new string containing the base-10 representation of an `NSTDUSize`.
+///
+/// # Note
+///
+/// It is possible for this function to return an empty string if allocating fails.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize v` - The arch-bit unsigned integer.
+///
+/// # Returns
+///
+/// `NSTDString string` - The new string.
+NSTDAPI NSTDString nstd_string_from_usize(NSTDUSize v);
+
+/// Creates a new string containing the base-10 representation of an `NSTDISize`.
+///
+/// # Note
+///
+/// It is possible for this function to return an empty string if allocating fails.
+///
+/// # Parameters:
+///
+/// - `NSTDISize v` - The arch-bit signed integer.
+///
+/// # Returns
+///
+/// `NSTDString string` - The new string.
+NSTDAPI NSTDString nstd_string_from_isize(NSTDISize v);
+
 /// Removes the last character from a string and returns it.
 ///
 /// # Parameters:
@@ -143,4 +390,6 @@ NSTDAPI NSTDUnichar nstd_string_pop(NSTDString *string);
 NSTDAPI void nstd_string_free(NSTDString string);
 
 NSTDCPPEND
+#include "string/builder.h"
+#include "string/cow.h"
 #endif
@@ -0,0 +1,133 @@
+#ifndef NSTD_STRING_BUILDER_H_INCLUDED
+#define NSTD_STRING_BUILDER_H_INCLUDED
+#include "../core/def.h"
+#include "../core/str.h"
+#include "../nstd.h"
+#include "../string.h"
+#include "../vec.h"
+NSTDCPPSTART
+
+/// A string builder that assembles large strings from a list of segments.
+typedef struct {
+    /// The builder's list of segments.
+    NSTDVec segments;
+    /// The total number of bytes in the builder.
+    NSTDUSize byte_len;
+} NSTDStringBuilder;
+
+/// A function used to stream a string builder's segments.
+///
+/// The first parameter is a string slice over the segment's data and the second parameter is the
+/// user data that was passed along with the function.
+typedef void (*NSTDStringBuilderWriter)(const NSTDStrConst *, NSTDAnyMut);
+
+/// Creates a new empty string builder.
+///
+/// # Returns
+///
+/// `NSTDStringBuilder builder` - The new string builder.
+NSTDAPI NSTDStringBuilder nstd_string_builder_new();
+
+/// Returns the total number of bytes in a string builder.
+///
+/// # Parameters:
+///
+/// - `const NSTDStringBuilder *builder` - The string builder.
+///
+/// # Returns
+///
+/// `NSTDUSize byte_len` - The total number of bytes appended to the builder.
+NSTDAPI NSTDUSize nstd_string_builder_byte_len(const NSTDStringBuilder *builder);
+
+/// Appends a copy of a string slice to the end of a string builder.
+///
+/// The bytes are copied into the builder's active chunk when they fit, otherwise a new chunk is
+/// allocated. Previously appended data is never moved. Appends are never split across chunks so
+/// each of the builder's segments remains valid UTF-8 on it's own.
+///
+/// # Parameters:
+///
+/// - `NSTDStringBuilder *builder` - The string builder.
+///
+/// - `const NSTDStrConst *str` - The string slice to append.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `str`'s data is invalid.
+NSTDAPI NSTDErrorCode nstd_string_builder_append(NSTDStringBuilder *builder,
+const NSTDStrConst *str);
+
+/// Appends a string slice to the end of a string builder by reference, without copying it's data.
+///
+/// # Parameters:
+///
+/// - `NSTDStringBuilder *builder` - The string builder.
+///
+/// - `const NSTDStrConst *str` - The string slice to append by reference.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// `str`'s data must remain valid and unmodified for the lifetime of the builder and anything
+/// built from it's segments.
+NSTDAPI NSTDErrorCode nstd_string_builder_append_borrowed(NSTDStringBuilder *builder,
+const NSTDStrConst *str);
+
+/// Streams each of a string builder's segments through `writer` in order, without materializing
+/// a contiguous string.
+///
+/// # Parameters:
+///
+/// - `const NSTDStringBuilder *builder` - The string builder.
+///
+/// - `NSTDStringBuilderWriter writer` - The function to stream each segment through.
+///
+/// - `NSTDAnyMut data` - User data to pass along with each segment.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if any of the builder's borrowed segments have
+/// been invalidated.
+NSTDAPI void nstd_string_builder_for_each(const NSTDStringBuilder *builder,
+NSTDStringBuilderWriter writer, NSTDAnyMut data);
+
+/// Materializes a string builder's contents into a contiguous `NSTDString`, taking ownership of
+/// the builder.
+///
+/// The string's buffer is created with a single exact allocation and filled with one gather pass
+/// over the builder's segments.
+///
+/// # Parameters:
+///
+/// - `NSTDStringBuilder builder` - The string builder to materialize.
+///
+/// # Returns
+///
+/// `NSTDString string` - The materialized string.
+///
+/// # Panics
+///
+/// This operation will panic if allocating for the new string fails.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if any of the builder's borrowed segments have
+/// been invalidated.
+NSTDAPI NSTDString nstd_string_builder_build(NSTDStringBuilder builder);
+
+/// Frees an instance of `NSTDStringBuilder`, along with all of it's owned chunks.
+///
+/// # Parameters:
+///
+/// - `NSTDStringBuilder builder` - The string builder to free.
+NSTDAPI void nstd_string_builder_free(NSTDStringBuilder builder);
+
+NSTDCPPEND
+#endif
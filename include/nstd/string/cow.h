@@ -0,0 +1,135 @@
+#ifndef NSTD_STRING_COW_H_INCLUDED
+#define NSTD_STRING_COW_H_INCLUDED
+#include "../core/def.h"
+#include "../core/str.h"
+#include "../nstd.h"
+#include "../string.h"
+#include "../vec/cow.h"
+NSTDCPPSTART
+
+/// A copy-on-write wrapper around `NSTDString`.
+typedef struct {
+    /// The underlying copy-on-write UTF-8 encoded byte buffer.
+    NSTDCowVec bytes;
+} NSTDCowString;
+
+/// Creates a new copy-on-write string, taking ownership of `string`.
+///
+/// # Parameters:
+///
+/// - `NSTDString string` - The string to wrap.
+///
+/// # Returns
+///
+/// `NSTDCowString cow` - The new copy-on-write string.
+NSTDAPI NSTDCowString nstd_cow_string_from_string(NSTDString string);
+
+/// Creates a new clone of `cow` that shares it's buffer.
+///
+/// This operation is O(1) and does not copy the string's bytes, the buffer is shared between the
+/// clones until one of them is mutated.
+///
+/// # Parameters:
+///
+/// - `NSTDCowString *cow` - The string to clone.
+///
+/// # Returns
+///
+/// `NSTDCowString cloned` - The new clone of `cow`.
+///
+/// # Panics
+///
+/// This operation will panic if allocating space for the owner count fails.
+NSTDAPI NSTDCowString nstd_cow_string_clone(NSTDCowString *cow);
+
+/// Returns the number of strings sharing `cow`'s buffer.
+///
+/// # Parameters:
+///
+/// - `const NSTDCowString *cow` - The copy-on-write string.
+///
+/// # Returns
+///
+/// `NSTDUSize owners` - The number of strings sharing `cow`'s buffer, 1 if the buffer is
+/// privately owned.
+NSTDAPI NSTDUSize nstd_cow_string_owners(const NSTDCowString *cow);
+
+/// Returns the number of bytes in a copy-on-write string.
+///
+/// # Parameters:
+///
+/// - `const NSTDCowString *cow` - The copy-on-write string.
+///
+/// # Returns
+///
+/// `NSTDUSize byte_len` - The number of bytes in the string.
+NSTDAPI NSTDUSize nstd_cow_string_byte_len(const NSTDCowString *cow);
+
+/// Returns an immutable string slice containing a copy-on-write string's data.
+///
+/// This operation never materializes a private copy.
+///
+/// # Parameters:
+///
+/// - `const NSTDCowString *cow` - The copy-on-write string.
+///
+/// # Returns
+///
+/// `NSTDStrConst str` - An *immutable* view into the string.
+NSTDAPI NSTDStrConst nstd_cow_string_as_str(const NSTDCowString *cow);
+
+/// Returns a mutable string slice containing a copy-on-write string's data, materializing a
+/// private copy of the buffer if it is currently shared.
+///
+/// # Parameters:
+///
+/// - `NSTDCowString *cow` - The copy-on-write string.
+///
+/// # Returns
+///
+/// `NSTDStrMut str` - A *mutable* view into the string, or an empty string slice if materializing
+/// a private copy of the buffer fails.
+NSTDAPI NSTDStrMut nstd_cow_string_as_str_mut(NSTDCowString *cow);
+
+/// Pushes an `NSTDUnichar` onto the end of a copy-on-write string, materializing a private copy
+/// of the buffer if it is currently shared.
+///
+/// # Parameters:
+///
+/// - `NSTDCowString *cow` - The copy-on-write string.
+///
+/// - `NSTDUnichar chr` - The Unicode character to append to the string.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+NSTDAPI NSTDErrorCode nstd_cow_string_push(NSTDCowString *cow, NSTDUnichar chr);
+
+/// Returns ownership of a copy-on-write string's data as an `NSTDString`, taking ownership of
+/// `cow`.
+///
+/// If the buffer is privately owned this is a simple handoff, otherwise a private copy of the
+/// buffer is materialized first.
+///
+/// # Parameters:
+///
+/// - `NSTDCowString cow` - The copy-on-write string.
+///
+/// # Returns
+///
+/// `NSTDString string` - A string that privately owns the data.
+///
+/// # Panics
+///
+/// This operation will panic if materializing a private copy of the buffer fails.
+NSTDAPI NSTDString nstd_cow_string_into_string(NSTDCowString cow);
+
+/// Frees an instance of `NSTDCowString`.
+///
+/// # Parameters:
+///
+/// - `NSTDCowString cow` - The copy-on-write string to free.
+NSTDAPI void nstd_cow_string_free(NSTDCowString cow);
+
+NSTDCPPEND
+#endif
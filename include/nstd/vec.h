@@ -1,8 +1,10 @@
 #ifndef NSTD_VEC_H_INCLUDED
 #define NSTD_VEC_H_INCLUDED
 #include "core/def.h"
+#include "core/range.h"
 #include "core/slice.h"
 #include "nstd.h"
+#include "vec/small.h"
 NSTDCPPSTART
 
 /// A dynamically sized contiguous sequence of values.
@@ -11,8 +13,21 @@ typedef struct {
     NSTDSliceMut buffer;
     /// The number of active elements in the vector.
     NSTDUSize len;
+    /// The alignment (in bytes) of the vector's memory buffer.
+    NSTDUSize align;
+    /// The vector's growth factor as a percentage of it's current capacity, at least 100.
+    NSTDUSize growth;
+    /// The minimum number of spare elements kept as headroom when the vector is shrunk.
+    NSTDUSize min_slack;
 } NSTDVec;
 
+/// A predicate over a vector's elements.
+///
+/// The first parameter is a pointer to the element being tested and the second parameter is the
+/// user data that was passed along with the predicate. The predicate shall return `NSTD_TRUE` to
+/// keep the element.
+typedef NSTDBool (*NSTDVecPredicate)(NSTDAnyConst, NSTDAnyMut);
+
 /// Creates a new vector without allocating any resources.
 ///
 /// # Parameters:
@@ -49,6 +64,57 @@ NSTDAPI NSTDVec nstd_vec_new(NSTDUSize element_size);
 /// This function will panic if either `element_size` or `cap` are zero.
 NSTDAPI NSTDVec nstd_vec_new_with_cap(NSTDUSize element_size, NSTDUSize cap);
 
+/// Creates a new vector of `len` zero-initialized elements.
+///
+/// The buffer is requested from the allocator already zeroed, letting the operating system hand
+/// over zero pages directly instead of the vector zeroing the memory itself.
+///
+/// # Note
+///
+/// This will return a "null vector" (a vector that has not allocated yet) on error.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize element_size` - The size in bytes of each value in the vector.
+///
+/// - `NSTDUSize len` - The number of zero-initialized elements in the vector.
+///
+/// # Returns
+///
+/// `NSTDVec vec` - The new vector.
+///
+/// # Panics
+///
+/// This function will panic if either `element_size` or `len` are zero.
+NSTDAPI NSTDVec nstd_vec_new_with_len_zeroed(NSTDUSize element_size, NSTDUSize len);
+
+/// Creates a new vector initialized with the given capacity, whose memory buffer is aligned to
+/// `align` bytes.
+///
+/// The buffer's alignment is preserved when the vector's capacity grows.
+///
+/// # Note
+///
+/// This will return a "null vector" (a vector that has not allocated yet) on error.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize element_size` - The size in bytes of each value in the vector.
+///
+/// - `NSTDUSize align` - The alignment (in bytes) of the vector's memory buffer.
+///
+/// - `NSTDUSize cap` - The initial capacity for the vector.
+///
+/// # Returns
+///
+/// `NSTDVec vec` - The new vector.
+///
+/// # Panics
+///
+/// This function will panic if either `element_size` or `cap` are zero, or `align` is not a power
+/// of two.
+NSTDAPI NSTDVec nstd_vec_new_aligned(NSTDUSize element_size, NSTDUSize align, NSTDUSize cap);
+
 /// Creates a new deep copy of `vec`.
 ///
 /// # Parameters:
@@ -73,7 +139,27 @@ NSTDAPI NSTDVec nstd_vec_clone(const NSTDVec *vec);
 /// # Returns
 ///
 /// `NSTDUSize len` - The length of the vector.
-NSTDAPI NSTDUSize nstd_vec_len(const NSTDVec *vec);
+///
+/// # Note
+///
+/// This function is implemented inline in the header so that C/C++ callers can avoid the
+/// cross-language call overhead in per-element loops.
+static inline NSTDUSize nstd_vec_len(const NSTDVec *vec) {
+    return vec->len;
+}
+
+/// Returns a vector's capacity.
+///
+/// This is the number of elements the vector can contain without reallocating.
+///
+/// # Parameters:
+///
+/// - `const NSTDVec *vec` - The vector.
+///
+/// # Returns
+///
+/// `NSTDUSize cap` - The vector's capacity.
+NSTDAPI NSTDUSize nstd_vec_cap(const NSTDVec *vec);
 
 /// Returns an immutable slice containing all of a vector's active elements.
 ///
@@ -126,6 +212,9 @@ NSTDAPI NSTDAnyMut nstd_vec_as_mut_ptr(NSTDVec *vec);
 /// It is highly advised to copy the return value onto the stack because the pointer can easily
 /// become invalid if the vector is mutated.
 ///
+/// This function is implemented inline in the header so that C/C++ callers can avoid the
+/// cross-language call overhead in per-element loops.
+///
 /// # Parameters:
 ///
 /// - `const NSTDVec *vec` - The vector to read an element from.
@@ -136,7 +225,12 @@ NSTDAPI NSTDAnyMut nstd_vec_as_mut_ptr(NSTDVec *vec);
 ///
 /// `NSTDAnyConst element` - A pointer to the element at `pos` or `NSTD_NULL` if `pos` is out
 /// of the vector's boundaries.
-NSTDAPI NSTDAnyConst nstd_vec_get(const NSTDVec *vec, NSTDUSize pos);
+static inline NSTDAnyConst nstd_vec_get(const NSTDVec *vec, NSTDUSize pos) {
+    if (pos < vec->len) {
+        return (const NSTDByte *)vec->buffer.ptr.raw + pos * vec->buffer.ptr.size;
+    }
+    return NSTD_NULL;
+}
 
 /// Returns a pointer to the element at index `pos` in `vec`.
 ///
@@ -232,6 +326,40 @@ NSTDAPI NSTDErrorCode nstd_vec_insert(NSTDVec *vec, NSTDAnyConst value, NSTDUSiz
 /// `NSTDErrorCode errc` - Nonzero if `index` is invalid.
 NSTDAPI NSTDErrorCode nstd_vec_remove(NSTDVec *vec, NSTDUSize index);
 
+/// Removes the element at `index` in a vector by replacing it with the last element.
+///
+/// Unlike `nstd_vec_remove` this operation is O(1), but it does not preserve the order of the
+/// vector's elements.
+///
+/// # Parameters:
+///
+/// - `NSTDVec *vec` - The vector.
+///
+/// - `NSTDUSize index` - The index of the element to remove.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero if `index` is invalid.
+NSTDAPI NSTDErrorCode nstd_vec_swap_remove(NSTDVec *vec, NSTDUSize index);
+
+/// Keeps only the elements of a vector for which `predicate` returns `NSTD_TRUE`, compacting the
+/// vector in a single pass.
+///
+/// The order of the retained elements is preserved.
+///
+/// # Parameters:
+///
+/// - `NSTDVec *vec` - The vector to filter.
+///
+/// - `NSTDVecPredicate predicate` - The predicate to test each element with.
+///
+/// - `NSTDAnyMut ctx` - User data to pass to the predicate on each call.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `vec`'s data is invalid.
+NSTDAPI void nstd_vec_retain(NSTDVec *vec, NSTDVecPredicate predicate, NSTDAnyMut ctx);
+
 /// Pushes a series of values onto a vector.
 ///
 /// # Parameters:
@@ -253,6 +381,108 @@ NSTDAPI NSTDErrorCode nstd_vec_remove(NSTDVec *vec, NSTDUSize index);
 /// This operation can cause undefined behavior if `values`'s data is invalid.
 NSTDAPI NSTDErrorCode nstd_vec_extend(NSTDVec *vec, const NSTDSliceConst *values);
 
+/// Extends a vector with `count` uninitialized elements, returning a slice over the new tail.
+///
+/// The vector's length is bumped before returning so decoders can write their output directly
+/// into the vector's buffer, without staging through a scratch buffer and copying it over with
+/// `nstd_vec_extend`.
+///
+/// # Parameters:
+///
+/// - `NSTDVec *vec` - The vector to extend.
+///
+/// - `NSTDUSize count` - The number of uninitialized elements to append.
+///
+/// # Returns
+///
+/// `NSTDSliceMut slice` - A *mutable* view over the `count` new elements, or an empty slice if
+/// reserving memory for the extension fails.
+///
+/// # Safety
+///
+/// The new elements are uninitialized, the caller must initialize them before they are read.
+NSTDAPI NSTDSliceMut nstd_vec_extend_uninit(NSTDVec *vec, NSTDUSize count);
+
+/// Splits a vector in two at `index`, returning a new vector that takes ownership of all
+/// elements at and after `index`.
+///
+/// When `index` is 0 this is a simple buffer handoff, leaving `vec` as a "null vector", otherwise
+/// the tail elements are moved into the new vector with a single copy.
+///
+/// # Note
+///
+/// This will return a "null vector" (a vector that has not allocated yet) on error.
+///
+/// # Parameters:
+///
+/// - `NSTDVec *vec` - The vector to split.
+///
+/// - `NSTDUSize index` - The index at which to split the vector.
+///
+/// # Returns
+///
+/// `NSTDVec tail` - A new vector containing the elements of `vec` starting at `index`.
+///
+/// # Panics
+///
+/// This operation will panic if `index` is greater than `vec`'s length.
+NSTDAPI NSTDVec nstd_vec_split_off(NSTDVec *vec, NSTDUSize index);
+
+/// Moves a range of elements out of a vector and into `dst`, compacting the vector in a single
+/// pass.
+///
+/// # Parameters:
+///
+/// - `NSTDVec *vec` - The vector to drain.
+///
+/// - `NSTDURange range` - The range of elements to move out of the vector.
+///
+/// - `NSTDSliceMut *dst` - The slice to move the drained elements into.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Possible errors
+///
+/// - `1` - `range` is out of the vector's boundaries or `range.start` is greater than `range.end`.
+///
+/// - `2` - `dst` is too small to hold the drained elements.
+///
+/// # Panics
+///
+/// This operation will panic if the element sizes for `vec` and `dst` do not match.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `dst`'s data is invalid.
+NSTDAPI NSTDErrorCode nstd_vec_drain(NSTDVec *vec, NSTDURange range, NSTDSliceMut *dst);
+
+/// Appends a range of elements from `src` onto the end of `dest` with a single copy.
+///
+/// # Parameters:
+///
+/// - `NSTDVec *dest` - The vector to copy the elements into.
+///
+/// - `const NSTDVec *src` - The vector to copy the elements from.
+///
+/// - `NSTDURange range` - The range of elements in `src` to copy.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Possible errors
+///
+/// - `1` - `range` is out of `src`'s boundaries or `range.start` is greater than `range.end`.
+///
+/// - `2` - Reserving memory for the new elements fails.
+///
+/// # Panics
+///
+/// This operation will panic if the element sizes for `dest` and `src` do not match.
+NSTDAPI NSTDErrorCode nstd_vec_copy_range(NSTDVec *dest, const NSTDVec *src, NSTDURange range);
+
 /// Shortens a vector, keeping the first `len` elements.
 ///
 /// # Note
@@ -269,6 +499,11 @@ NSTDAPI void nstd_vec_truncate(NSTDVec *vec, NSTDUSize len);
 /// Reserves some space on the heap for at least `size` more elements to be pushed onto a vector
 /// without making more allocations.
 ///
+/// To amortize the cost of repeated small reservations, this may reserve more space than
+/// requested, growing the vector's capacity by it's growth factor (at least half by default, see
+/// `nstd_vec_set_growth_policy`). Use `nstd_vec_reserve_exact` when the final size is known up
+/// front.
+///
 /// # Parameters:
 ///
 /// - `NSTDVec *vec` - The vector to reserve space for.
@@ -284,7 +519,29 @@ NSTDAPI void nstd_vec_truncate(NSTDVec *vec, NSTDUSize len);
 /// This operation will panic if `size` is zero.
 NSTDAPI NSTDErrorCode nstd_vec_reserve(NSTDVec *vec, NSTDUSize size);
 
-/// Decreases a vector's capacity to match it's length.
+/// Reserves space on the heap for exactly `size` more elements to be pushed onto a vector without
+/// making more allocations.
+///
+/// # Parameters:
+///
+/// - `NSTDVec *vec` - The vector to reserve space for.
+///
+/// - `NSTDUSize size` - The number of additional elements to allocate for.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Panics
+///
+/// This operation will panic if `size` is zero.
+NSTDAPI NSTDErrorCode nstd_vec_reserve_exact(NSTDVec *vec, NSTDUSize size);
+
+/// Decreases a vector's capacity to match it's length, plus the vector's minimum slack.
+///
+/// Keeping a minimum amount of spare capacity (see `nstd_vec_set_growth_policy`) lets vectors
+/// that repeatedly fill and drain settle at a stable capacity instead of oscillating between
+/// reallocations on growth and shrink.
 ///
 /// # Note
 ///
@@ -299,6 +556,36 @@ NSTDAPI NSTDErrorCode nstd_vec_reserve(NSTDVec *vec, NSTDUSize size);
 /// `NSTDErrorCode errc` - Nonzero on error.
 NSTDAPI NSTDErrorCode nstd_vec_shrink(NSTDVec *vec);
 
+/// Sets a vector's growth policy.
+///
+/// `growth` is the factor (as a percentage of the current capacity, at least 100) the capacity
+/// is grown by when `nstd_vec_reserve` needs more space, and `min_slack` is the minimum number
+/// of spare elements `nstd_vec_shrink` keeps as headroom. Vectors that repeatedly fill and drain
+/// can use the slack to settle at a stable capacity and stop reallocating entirely.
+///
+/// # Parameters:
+///
+/// - `NSTDVec *vec` - The vector.
+///
+/// - `NSTDUSize growth` - The vector's new growth factor as a percentage, at least 100.
+///
+/// - `NSTDUSize min_slack` - The minimum number of spare elements to keep when shrinking.
+///
+/// # Panics
+///
+/// This operation will panic if `growth` is less than 100.
+NSTDAPI void nstd_vec_set_growth_policy(NSTDVec *vec, NSTDUSize growth, NSTDUSize min_slack);
+
+/// Removes all of a vector's elements without touching the vector's buffer.
+///
+/// The capacity is left intact so the vector can be refilled without reallocating, making it
+/// suitable for buffers that are reused across iterations.
+///
+/// # Parameters:
+///
+/// - `NSTDVec *vec` - The vector to clear.
+NSTDAPI void nstd_vec_clear_and_keep_cap(NSTDVec *vec);
+
 /// Frees an instance of `NSTDVec`.
 ///
 /// # Parameters:
@@ -307,4 +594,5 @@ NSTDAPI NSTDErrorCode nstd_vec_shrink(NSTDVec *vec);
 NSTDAPI void nstd_vec_free(NSTDVec vec);
 
 NSTDCPPEND
+#include "vec/cow.h"
 #endif
@@ -0,0 +1,168 @@
+#ifndef NSTD_VEC_COW_H_INCLUDED
+#define NSTD_VEC_COW_H_INCLUDED
+#include "../core/def.h"
+#include "../core/slice.h"
+#include "../nstd.h"
+#include "../vec.h"
+NSTDCPPSTART
+
+/// A copy-on-write wrapper around `NSTDVec`.
+typedef struct {
+    /// The vector, it's buffer may be shared with other clones while `owners` is non-null.
+    NSTDVec vec;
+    /// A pointer to the shared buffer's owner count, null while the vector owns it's buffer
+    /// privately.
+    NSTDAnyMut owners;
+} NSTDCowVec;
+
+/// Creates a new copy-on-write vector, taking ownership of `vec`.
+///
+/// # Parameters:
+///
+/// - `NSTDVec vec` - The vector to wrap.
+///
+/// # Returns
+///
+/// `NSTDCowVec cow` - The new copy-on-write vector.
+///
+/// # Panics
+///
+/// This operation will panic if `vec`'s buffer is aligned above one byte.
+NSTDAPI NSTDCowVec nstd_cow_vec_from_vec(NSTDVec vec);
+
+/// Creates a new clone of `cow` that shares it's buffer.
+///
+/// This operation is O(1) and does not copy the vector's elements, the buffer is shared between
+/// the clones until one of them is mutated. The first clone of a privately owned buffer extends
+/// the buffer's allocation to make room for the owner count.
+///
+/// # Parameters:
+///
+/// - `NSTDCowVec *cow` - The vector to clone.
+///
+/// # Returns
+///
+/// `NSTDCowVec cloned` - The new clone of `cow`.
+///
+/// # Panics
+///
+/// This operation will panic if allocating space for the owner count fails.
+NSTDAPI NSTDCowVec nstd_cow_vec_clone(NSTDCowVec *cow);
+
+/// Returns the number of vectors sharing `cow`'s buffer.
+///
+/// # Parameters:
+///
+/// - `const NSTDCowVec *cow` - The copy-on-write vector.
+///
+/// # Returns
+///
+/// `NSTDUSize owners` - The number of vectors sharing `cow`'s buffer, 1 if the buffer is privately
+/// owned.
+NSTDAPI NSTDUSize nstd_cow_vec_owners(const NSTDCowVec *cow);
+
+/// Returns the length of a copy-on-write vector.
+///
+/// # Parameters:
+///
+/// - `const NSTDCowVec *cow` - The copy-on-write vector.
+///
+/// # Returns
+///
+/// `NSTDUSize len` - The length of the vector.
+NSTDAPI NSTDUSize nstd_cow_vec_len(const NSTDCowVec *cow);
+
+/// Returns an immutable slice containing all of a copy-on-write vector's active elements.
+///
+/// This operation never materializes a private copy.
+///
+/// # Parameters:
+///
+/// - `const NSTDCowVec *cow` - The copy-on-write vector.
+///
+/// # Returns
+///
+/// `NSTDSliceConst slice` - An *immutable* view into the vector.
+NSTDAPI NSTDSliceConst nstd_cow_vec_as_slice(const NSTDCowVec *cow);
+
+/// Returns a mutable slice containing all of a copy-on-write vector's active elements,
+/// materializing a private copy of the buffer if it is currently shared.
+///
+/// # Parameters:
+///
+/// - `NSTDCowVec *cow` - The copy-on-write vector.
+///
+/// # Returns
+///
+/// `NSTDSliceMut slice` - A *mutable* view into the vector, or an empty slice if materializing a
+/// private copy of the buffer fails.
+NSTDAPI NSTDSliceMut nstd_cow_vec_as_slice_mut(NSTDCowVec *cow);
+
+/// Pushes a value onto a copy-on-write vector, materializing a private copy of the buffer if it
+/// is currently shared.
+///
+/// # Parameters:
+///
+/// - `NSTDCowVec *cow` - The copy-on-write vector.
+///
+/// - `NSTDAnyConst value` - A pointer to the value to push onto the vector.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// This operation is unsafe because undefined behaviour can occur if the size of the value being
+/// pushed onto the vector is not equal to the vector's element size.
+NSTDAPI NSTDErrorCode nstd_cow_vec_push(NSTDCowVec *cow, NSTDAnyConst value);
+
+/// Pushes a series of values onto a copy-on-write vector, materializing a private copy of the
+/// buffer if it is currently shared.
+///
+/// # Parameters:
+///
+/// - `NSTDCowVec *cow` - The copy-on-write vector to extend.
+///
+/// - `const NSTDSliceConst *values` - A slice of values to push onto the vector.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Panics
+///
+/// This operation will panic if the element sizes for `cow` and `values` do not match.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `values`'s data is invalid.
+NSTDAPI NSTDErrorCode nstd_cow_vec_extend(NSTDCowVec *cow, const NSTDSliceConst *values);
+
+/// Returns ownership of a copy-on-write vector's data as an `NSTDVec`, taking ownership of `cow`.
+///
+/// If the buffer is privately owned this is a simple handoff, otherwise a private copy of the
+/// buffer is materialized first.
+///
+/// # Parameters:
+///
+/// - `NSTDCowVec cow` - The copy-on-write vector.
+///
+/// # Returns
+///
+/// `NSTDVec vec` - A vector that privately owns the data.
+///
+/// # Panics
+///
+/// This operation will panic if materializing a private copy of the buffer fails.
+NSTDAPI NSTDVec nstd_cow_vec_into_vec(NSTDCowVec cow);
+
+/// Frees an instance of `NSTDCowVec`.
+///
+/// # Parameters:
+///
+/// - `NSTDCowVec cow` - The copy-on-write vector to free.
+NSTDAPI void nstd_cow_vec_free(NSTDCowVec cow);
+
+NSTDCPPEND
+#endif
@@ -0,0 +1,194 @@
+#ifndef NSTD_VEC_SMALL_H_INCLUDED
+#define NSTD_VEC_SMALL_H_INCLUDED
+#include "../core/def.h"
+#include "../core/slice.h"
+#include "../nstd.h"
+NSTDCPPSTART
+
+/// The size (in bytes) of a small vector's inline buffer.
+#define NSTD_SMALL_VEC_BUFFER_SIZE 64
+
+/// A dynamically sized contiguous sequence of values with a small-buffer optimization.
+typedef struct {
+    /// The inline memory buffer, active while the vector's elements fit within it.
+    NSTDByte buffer[NSTD_SMALL_VEC_BUFFER_SIZE];
+    /// A pointer to the heap memory buffer, null while the vector is inline.
+    NSTDAnyMut ptr;
+    /// The size in bytes of each value in the vector.
+    NSTDUSize element_size;
+    /// The number of elements the active memory buffer can hold.
+    NSTDUSize cap;
+    /// The number of active elements in the vector.
+    NSTDUSize len;
+} NSTDSmallVec;
+
+/// Creates a new small vector without allocating any resources.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize element_size` - The size in bytes of each value in the vector.
+///
+/// # Returns
+///
+/// `NSTDSmallVec vec` - The new small vector.
+///
+/// # Panics
+///
+/// This function will panic if `element_size` is zero.
+NSTDAPI NSTDSmallVec nstd_vec_small_new(NSTDUSize element_size);
+
+/// Returns the length of a small vector.
+///
+/// # Parameters:
+///
+/// - `const NSTDSmallVec *vec` - The small vector.
+///
+/// # Returns
+///
+/// `NSTDUSize len` - The length of the small vector.
+NSTDAPI NSTDUSize nstd_vec_small_len(const NSTDSmallVec *vec);
+
+/// Returns a small vector's capacity.
+///
+/// This is the number of elements the small vector can contain without reallocating.
+///
+/// # Parameters:
+///
+/// - `const NSTDSmallVec *vec` - The small vector.
+///
+/// # Returns
+///
+/// `NSTDUSize cap` - The small vector's capacity.
+NSTDAPI NSTDUSize nstd_vec_small_cap(const NSTDSmallVec *vec);
+
+/// Determines whether or not a small vector's elements have spilled to the heap.
+///
+/// # Parameters:
+///
+/// - `const NSTDSmallVec *vec` - The small vector.
+///
+/// # Returns
+///
+/// `NSTDBool is_heap` - `NSTD_TRUE` if the small vector's elements live on the heap.
+NSTDAPI NSTDBool nstd_vec_small_is_heap(const NSTDSmallVec *vec);
+
+/// Returns an immutable slice containing all of a small vector's active elements.
+///
+/// # Parameters:
+///
+/// - `const NSTDSmallVec *vec` - The small vector.
+///
+/// # Returns
+///
+/// `NSTDSliceConst slice` - An *immutable* view into the small vector.
+NSTDAPI NSTDSliceConst nstd_vec_small_as_slice(const NSTDSmallVec *vec);
+
+/// Returns a slice containing all of a small vector's active elements.
+///
+/// # Parameters:
+///
+/// - `NSTDSmallVec *vec` - The small vector.
+///
+/// # Returns
+///
+/// `NSTDSliceMut slice` - A *mutable* view into the small vector.
+NSTDAPI NSTDSliceMut nstd_vec_small_as_slice_mut(NSTDSmallVec *vec);
+
+/// Returns a pointer to a small vector's raw data.
+///
+/// # Note
+///
+/// It is highly advised to copy the return value onto the stack because the pointer can easily
+/// become invalid if the small vector is mutated.
+///
+/// # Parameters:
+///
+/// - `const NSTDSmallVec *vec` - The small vector.
+///
+/// # Returns
+///
+/// `NSTDAnyConst ptr` - A pointer to the small vector's raw data.
+NSTDAPI NSTDAnyConst nstd_vec_small_as_ptr(const NSTDSmallVec *vec);
+
+/// Returns a pointer to a small vector's raw data.
+///
+/// # Note
+///
+/// It is highly advised to copy the return value onto the stack because the pointer can easily
+/// become invalid if the small vector is mutated.
+///
+/// # Parameters:
+///
+/// - `NSTDSmallVec *vec` - The small vector.
+///
+/// # Returns
+///
+/// `NSTDAnyMut ptr` - A pointer to the small vector's raw data.
+NSTDAPI NSTDAnyMut nstd_vec_small_as_mut_ptr(NSTDSmallVec *vec);
+
+/// Pushes a value onto a small vector by copying bytes to the end of the vector's active buffer.
+/// The number of bytes to push is determined by `vec`'s element size.
+///
+/// # Parameters:
+///
+/// - `NSTDSmallVec *vec` - The small vector.
+///
+/// - `NSTDAnyConst value` - A pointer to the value to push onto the small vector.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// This operation is unsafe because undefined behaviour can occur if the size of the value being
+/// pushed onto the small vector is not equal to `vec`'s element size.
+NSTDAPI NSTDErrorCode nstd_vec_small_push(NSTDSmallVec *vec, NSTDAnyConst value);
+
+/// Removes the last value of a small vector and returns a pointer to it.
+///
+/// # Note
+///
+/// It is highly advised to copy the return value onto the stack because the pointer can easily
+/// become invalid if the small vector is mutated.
+///
+/// # Parameters:
+///
+/// - `NSTDSmallVec *vec` - The small vector.
+///
+/// # Returns
+///
+/// - `NSTDAnyConst value` - A pointer to the value that was popped off the stack, or null if the
+/// small vector is empty.
+NSTDAPI NSTDAnyConst nstd_vec_small_pop(NSTDSmallVec *vec);
+
+/// Pushes a series of values onto a small vector.
+///
+/// # Parameters:
+///
+/// - `NSTDSmallVec *vec` - The small vector to extend.
+///
+/// - `const NSTDSliceConst *values` - A slice of values to push onto the small vector.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero if reserving memory for the extension fails.
+///
+/// # Panics
+///
+/// This operation will panic if the element sizes for `vec` and `values` do not match.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `values`'s data is invalid.
+NSTDAPI NSTDErrorCode nstd_vec_small_extend(NSTDSmallVec *vec, const NSTDSliceConst *values);
+
+/// Frees an instance of `NSTDSmallVec`.
+///
+/// # Parameters:
+///
+/// - `NSTDSmallVec vec` - The small vector to free.
+NSTDAPI void nstd_vec_small_free(NSTDSmallVec vec);
+
+NSTDCPPEND
+#endif
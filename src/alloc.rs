@@ -1,4 +1,11 @@
 //! Low level memory allocation.
+pub mod arena;
+#[cfg(feature = "nstd_alloc_stats")]
+#[cfg_attr(doc_cfg, doc(cfg(feature = "nstd_alloc_stats")))]
+pub mod stats;
+#[cfg(feature = "nstd_alloc_pool")]
+#[cfg_attr(doc_cfg, doc(cfg(feature = "nstd_alloc_pool")))]
+pub mod pool;
 #[cfg(not(target_os = "windows"))]
 extern crate alloc;
 use crate::{core::def::NSTDErrorCode, NSTDAnyMut, NSTDUSize};
@@ -20,16 +27,20 @@ use crate::{core::def::NSTDErrorCode, NSTDAnyMut, NSTDUSize};
 #[inline]
 #[cfg_attr(feature = "clib", no_mangle)]
 pub unsafe extern "C" fn nstd_alloc_allocate(size: NSTDUSize) -> NSTDAnyMut {
+    let mem;
     #[cfg(not(target_os = "windows"))]
     {
         use alloc::alloc::Layout;
         let layout = Layout::from_size_align_unchecked(size, 1);
-        alloc::alloc::alloc(layout).cast()
+        mem = alloc::alloc::alloc(layout).cast();
     }
     #[cfg(target_os = "windows")]
     {
-        crate::os::windows::alloc::nstd_os_windows_alloc_allocate(size)
+        mem = crate::os::windows::alloc::nstd_os_windows_alloc_allocate(size);
     }
+    #[cfg(feature = "nstd_alloc_stats")]
+    stats::record_allocate(mem, size);
+    mem
 }
 
 /// Allocates a block of zero-initialized memory on the heap.
@@ -48,16 +59,73 @@ pub unsafe extern "C" fn nstd_alloc_allocate(size: NSTDUSize) -> NSTDAnyMut {
 #[inline]
 #[cfg_attr(feature = "clib", no_mangle)]
 pub unsafe extern "C" fn nstd_alloc_allocate_zeroed(size: NSTDUSize) -> NSTDAnyMut {
+    let mem;
     #[cfg(not(target_os = "windows"))]
     {
         use alloc::alloc::Layout;
         let layout = Layout::from_size_align_unchecked(size, 1);
-        alloc::alloc::alloc_zeroed(layout).cast()
+        mem = alloc::alloc::alloc_zeroed(layout).cast();
     }
     #[cfg(target_os = "windows")]
     {
-        crate::os::windows::alloc::nstd_os_windows_alloc_allocate_zeroed(size)
+        mem = crate::os::windows::alloc::nstd_os_windows_alloc_allocate_zeroed(size);
     }
+    #[cfg(feature = "nstd_alloc_stats")]
+    stats::record_allocate(mem, size);
+    mem
+}
+
+/// Allocates a block of memory on the heap, aligned to `align` bytes.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize size` - The number of bytes to allocate on the heap.
+///
+/// - `NSTDUSize align` - The alignment (in bytes) of the allocated memory.
+///
+/// # Returns
+///
+/// `NSTDAnyMut ptr` - A pointer to the allocated memory, null on error.
+///
+/// # Safety
+///
+/// This operation is unsafe because the behaviour is undefined if `size` is zero or `align` is not
+/// a power of two.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_alloc_allocate_aligned(
+    size: NSTDUSize,
+    align: NSTDUSize,
+) -> NSTDAnyMut {
+    let mem;
+    #[cfg(not(target_os = "windows"))]
+    {
+        use alloc::alloc::Layout;
+        let layout = Layout::from_size_align_unchecked(size, align);
+        mem = alloc::alloc::alloc(layout).cast();
+    }
+    #[cfg(target_os = "windows")]
+    {
+        // The Windows heap has no alignment parameter, over-allocate and store the base pointer
+        // of the allocation directly before the aligned block.
+        use crate::{core::def::NSTDByte, NSTD_NULL};
+        const PTR_SIZE: usize = core::mem::size_of::<usize>();
+        let base = crate::os::windows::alloc::nstd_os_windows_alloc_allocate(
+            size + align + PTR_SIZE,
+        );
+        mem = match base.is_null() {
+            true => NSTD_NULL,
+            false => {
+                let addr = base as usize + PTR_SIZE;
+                let aligned = (addr + align - 1) & !(align - 1);
+                *(aligned as *mut usize).sub(1) = base as usize;
+                aligned as *mut NSTDByte as NSTDAnyMut
+            }
+        };
+    }
+    #[cfg(feature = "nstd_alloc_stats")]
+    stats::record_allocate(mem, size);
+    mem
 }
 
 /// Reallocates a block of memory previously allocated by `nstd_alloc_allocate[_zeroed]`.
@@ -90,21 +158,97 @@ pub unsafe extern "C" fn nstd_alloc_reallocate(
     size: NSTDUSize,
     new_size: NSTDUSize,
 ) -> NSTDErrorCode {
+    let errc;
     #[cfg(not(target_os = "windows"))]
     {
         use alloc::alloc::Layout;
         let layout = Layout::from_size_align_unchecked(size, 1);
         let new_mem = alloc::alloc::realloc((*ptr).cast(), layout, new_size);
-        if !new_mem.is_null() {
-            *ptr = new_mem.cast();
-            return 0;
-        }
-        1
+        errc = match new_mem.is_null() {
+            true => 1,
+            false => {
+                *ptr = new_mem.cast();
+                0
+            }
+        };
     }
     #[cfg(target_os = "windows")]
     {
-        crate::os::windows::alloc::nstd_os_windows_alloc_reallocate(ptr, new_size)
+        errc = crate::os::windows::alloc::nstd_os_windows_alloc_reallocate(ptr, new_size);
     }
+    #[cfg(feature = "nstd_alloc_stats")]
+    stats::record_reallocate(errc);
+    errc
+}
+
+/// Reallocates a block of memory previously allocated by `nstd_alloc_allocate_aligned`.
+///
+/// If everything goes right, the pointer will point to the new memory location and 0 will be
+/// returned. If this is not the case and allocation fails, the pointer will remain untouched and a
+/// value of nonzero is returned.
+///
+/// # Parameters:
+///
+/// - `NSTDAnyMut *ptr` - A pointer to the allocated memory.
+///
+/// - `NSTDUSize size` - The number of bytes currently allocated.
+///
+/// - `NSTDUSize new_size` - The number of bytes to reallocate.
+///
+/// - `NSTDUSize align` - The alignment (in bytes) of the allocated memory.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// This operation is unsafe because the behaviour is undefined if `ptr` is not a value returned by
+/// `nstd_alloc_allocate_aligned`, or `align` does not match the value used for the allocation.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_alloc_reallocate_aligned(
+    ptr: &mut NSTDAnyMut,
+    size: NSTDUSize,
+    new_size: NSTDUSize,
+    align: NSTDUSize,
+) -> NSTDErrorCode {
+    let errc;
+    #[cfg(not(target_os = "windows"))]
+    {
+        use alloc::alloc::Layout;
+        let layout = Layout::from_size_align_unchecked(size, align);
+        let new_mem = alloc::alloc::realloc((*ptr).cast(), layout, new_size);
+        errc = match new_mem.is_null() {
+            true => 1,
+            false => {
+                *ptr = new_mem.cast();
+                0
+            }
+        };
+    }
+    #[cfg(target_os = "windows")]
+    {
+        // The over-allocation scheme cannot reallocate in place, allocate a new aligned block,
+        // copy the old data over and free the old block.
+        let new_mem = nstd_alloc_allocate_aligned(new_size, align);
+        errc = match new_mem.is_null() {
+            true => 1,
+            false => {
+                crate::core::mem::nstd_core_mem_copy(
+                    new_mem.cast(),
+                    (*ptr).cast(),
+                    size.min(new_size),
+                );
+                nstd_alloc_deallocate_aligned(ptr, size, align);
+                *ptr = new_mem;
+                0
+            }
+        };
+    }
+    #[cfg(feature = "nstd_alloc_stats")]
+    stats::record_reallocate(errc);
+    errc
 }
 
 /// Deallocates a block of memory previously allocated by `nstd_alloc_allocate[_zeroed]`.
@@ -123,6 +267,8 @@ pub unsafe extern "C" fn nstd_alloc_reallocate(
 #[cfg_attr(feature = "clib", no_mangle)]
 #[cfg_attr(target_os = "windows", allow(unused_variables))]
 pub unsafe extern "C" fn nstd_alloc_deallocate(ptr: &mut NSTDAnyMut, size: NSTDUSize) {
+    #[cfg(feature = "nstd_alloc_stats")]
+    stats::record_deallocate(size);
     #[cfg(not(target_os = "windows"))]
     {
         use crate::NSTD_NULL;
@@ -136,3 +282,44 @@ pub unsafe extern "C" fn nstd_alloc_deallocate(ptr: &mut NSTDAnyMut, size: NSTDU
         crate::os::windows::alloc::nstd_os_windows_alloc_deallocate(ptr);
     }
 }
+
+/// Deallocates a block of memory previously allocated by `nstd_alloc_allocate_aligned`.
+///
+/// # Parameters:
+///
+/// - `NSTDAnyMut *ptr` - A pointer to the allocated memory, once freed the pointer is set to null.
+///
+/// - `NSTDUSize size` - The number of bytes to free.
+///
+/// - `NSTDUSize align` - The alignment (in bytes) of the allocated memory.
+///
+/// # Safety
+///
+/// This operation is unsafe because the behaviour is undefined if `ptr` is not a value returned by
+/// `nstd_alloc_allocate_aligned`, or `align` does not match the value used for the allocation.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+#[cfg_attr(target_os = "windows", allow(unused_variables))]
+pub unsafe extern "C" fn nstd_alloc_deallocate_aligned(
+    ptr: &mut NSTDAnyMut,
+    size: NSTDUSize,
+    align: NSTDUSize,
+) {
+    #[cfg(feature = "nstd_alloc_stats")]
+    stats::record_deallocate(size);
+    #[cfg(not(target_os = "windows"))]
+    {
+        use crate::NSTD_NULL;
+        use alloc::alloc::Layout;
+        let layout = Layout::from_size_align_unchecked(size, align);
+        alloc::alloc::dealloc((*ptr).cast(), layout);
+        *ptr = NSTD_NULL;
+    }
+    #[cfg(target_os = "windows")]
+    {
+        // Retrieve the base pointer of the allocation stored directly before the aligned block.
+        let mut base = (*(*ptr as *mut usize).sub(1)) as NSTDAnyMut;
+        crate::os::windows::alloc::nstd_os_windows_alloc_deallocate(&mut base);
+        *ptr = crate::NSTD_NULL;
+    }
+}
@@ -0,0 +1,183 @@
+//! An arena allocator for many small, short-lived allocations.
+use crate::{
+    alloc::{nstd_alloc_allocate, nstd_alloc_deallocate},
+    NSTDAnyMut, NSTDUSize, NSTD_NULL,
+};
+
+/// The boundary (in bytes) that arena allocation sizes are rounded up to.
+const ARENA_ALIGN: NSTDUSize = 16;
+
+/// The size (in bytes) of a memory block's header, rounded up to `ARENA_ALIGN`.
+const HEADER_SIZE: NSTDUSize =
+    (core::mem::size_of::<BlockHeader>() + ARENA_ALIGN - 1) & !(ARENA_ALIGN - 1);
+
+/// Bookkeeping data stored at the beginning of each of an arena's memory blocks.
+#[repr(C)]
+struct BlockHeader {
+    /// A pointer to the next memory block in the chain, null for the last block.
+    next: NSTDAnyMut,
+    /// The number of usable bytes in the memory block, excluding the header.
+    size: NSTDUSize,
+    /// The number of bytes currently in use, excluding the header.
+    used: NSTDUSize,
+}
+
+/// An arena allocator.
+///
+/// Arenas allocate large blocks of memory up front and hand out portions of them with a simple
+/// pointer bump, making them ideal for grouping many small, short-lived allocations. Individual
+/// allocations cannot be freed, instead the whole arena is reset (or freed) at once.
+#[repr(C)]
+#[derive(Debug, Hash)]
+pub struct NSTDArena {
+    /// A pointer to the first memory block in the chain.
+    head: NSTDAnyMut,
+    /// A pointer to the memory block currently being allocated from.
+    current: NSTDAnyMut,
+    /// The preferred size (in bytes) of each memory block.
+    block_size: NSTDUSize,
+}
+impl NSTDArena {
+    /// Allocates a new memory block capable of holding at least `min_size` bytes and appends it to
+    /// the arena's block chain, returning null on error.
+    ///
+    /// # Safety
+    ///
+    /// `min_size` must not be zero.
+    unsafe fn push_block(&mut self, min_size: NSTDUSize) -> *mut BlockHeader {
+        let size = self.block_size.max(min_size);
+        let mem = nstd_alloc_allocate(HEADER_SIZE + size);
+        if mem.is_null() {
+            return core::ptr::null_mut();
+        }
+        let header = mem.cast::<BlockHeader>();
+        (*header).next = NSTD_NULL;
+        (*header).size = size;
+        (*header).used = 0;
+        match self.head.is_null() {
+            true => self.head = mem,
+            false => (*self.current.cast::<BlockHeader>()).next = mem,
+        }
+        self.current = mem;
+        header
+    }
+}
+impl Drop for NSTDArena {
+    /// [NSTDArena]'s destructor.
+    fn drop(&mut self) {
+        let mut block = self.head;
+        while !block.is_null() {
+            let header = block.cast::<BlockHeader>();
+            // SAFETY: Each block in the chain was allocated by `push_block`.
+            unsafe {
+                let next = (*header).next;
+                let block_size = HEADER_SIZE + (*header).size;
+                nstd_alloc_deallocate(&mut block, block_size);
+                block = next;
+            }
+        }
+    }
+}
+
+/// Creates a new arena allocator.
+///
+/// The arena does not allocate until it is first allocated from.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize block_size` - The preferred size (in bytes) of each of the arena's memory blocks.
+/// Allocations larger than `block_size` get a dedicated block.
+///
+/// # Returns
+///
+/// `NSTDArena arena` - The new arena allocator.
+///
+/// # Panics
+///
+/// This function will panic if `block_size` is zero.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_alloc_arena_new(block_size: NSTDUSize) -> NSTDArena {
+    assert!(block_size != 0);
+    NSTDArena {
+        head: NSTD_NULL,
+        current: NSTD_NULL,
+        block_size,
+    }
+}
+
+/// Allocates a block of memory within an arena.
+///
+/// The returned memory is valid until the arena is either reset or freed.
+///
+/// # Parameters:
+///
+/// - `NSTDArena *arena` - The arena to allocate from.
+///
+/// - `NSTDUSize size` - The number of bytes to allocate.
+///
+/// # Returns
+///
+/// `NSTDAnyMut ptr` - A pointer to the allocated memory, null on error.
+///
+/// # Safety
+///
+/// This operation is unsafe because the behaviour is undefined if `size` is zero.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_alloc_arena_allocate(
+    arena: &mut NSTDArena,
+    size: NSTDUSize,
+) -> NSTDAnyMut {
+    // Round the allocation size up to the arena's alignment boundary.
+    let size = (size + ARENA_ALIGN - 1) & !(ARENA_ALIGN - 1);
+    // Find the first block in the chain with enough free space, preferring the current block.
+    let mut header = arena.current.cast::<BlockHeader>();
+    while !header.is_null() && (*header).size - (*header).used < size {
+        let next = (*header).next.cast::<BlockHeader>();
+        if !next.is_null() {
+            arena.current = next.cast();
+        }
+        header = next;
+    }
+    // No block can hold the allocation, push a new one onto the chain.
+    if header.is_null() {
+        header = arena.push_block(size);
+        if header.is_null() {
+            return NSTD_NULL;
+        }
+    }
+    // Bump the current block's `used` marker.
+    let ptr = arena.current.add(HEADER_SIZE + (*header).used);
+    (*header).used += size;
+    ptr
+}
+
+/// Resets an arena allocator, invalidating all of its active allocations.
+///
+/// The arena's memory blocks are retained for reuse, no memory is returned to the heap.
+///
+/// # Parameters:
+///
+/// - `NSTDArena *arena` - The arena to reset.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_alloc_arena_reset(arena: &mut NSTDArena) {
+    let mut block = arena.head.cast::<BlockHeader>();
+    while !block.is_null() {
+        // SAFETY: Each block in the chain was allocated by `push_block`.
+        unsafe {
+            (*block).used = 0;
+            block = (*block).next.cast();
+        }
+    }
+    arena.current = arena.head;
+}
+
+/// Frees an instance of `NSTDArena`, invalidating all of its active allocations.
+///
+/// # Parameters:
+///
+/// - `NSTDArena arena` - The arena to free.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+#[allow(unused_variables)]
+pub extern "C" fn nstd_alloc_arena_free(arena: NSTDArena) {}
@@ -0,0 +1,131 @@
+//! A thread-cached pooled allocator for small allocations.
+use crate::{
+    alloc::{nstd_alloc_allocate, nstd_alloc_deallocate},
+    NSTDAnyMut, NSTDUSize, NSTD_NULL,
+};
+use core::cell::RefCell;
+
+/// The block size (in bytes) of each of the pool's size classes.
+const CLASS_SIZES: [NSTDUSize; 5] = [16, 32, 64, 128, 256];
+
+/// The largest allocation size (in bytes) served from the pool's free lists.
+const MAX_POOLED_SIZE: NSTDUSize = 256;
+
+/// Returns the index of the smallest size class that can hold `size` bytes, or `None` if `size` is
+/// too large to be pooled.
+#[inline]
+fn class_of(size: NSTDUSize) -> Option<usize> {
+    CLASS_SIZES.iter().position(|&class_size| size <= class_size)
+}
+
+/// A thread's cache of freed blocks, one singly linked free list per size class.
+///
+/// Each freed block stores a pointer to the next free block of its class in its first bytes.
+struct PoolCache {
+    /// The head of each size class's free list.
+    lists: [NSTDAnyMut; CLASS_SIZES.len()],
+}
+impl Drop for PoolCache {
+    /// [PoolCache]'s destructor, returns every cached block to the heap.
+    fn drop(&mut self) {
+        for (class, list) in self.lists.iter_mut().enumerate() {
+            let mut block = *list;
+            while !block.is_null() {
+                // SAFETY: Each block in the list was allocated by `nstd_alloc_allocate` with its
+                // class's size and holds the next free block's address in its first bytes.
+                unsafe {
+                    let next = core::ptr::read_unaligned(block.cast::<NSTDAnyMut>());
+                    nstd_alloc_deallocate(&mut block, CLASS_SIZES[class]);
+                    block = next;
+                }
+            }
+        }
+    }
+}
+
+std::thread_local! {
+    /// The current thread's cache of freed blocks.
+    static CACHE: RefCell<PoolCache> = const {
+        RefCell::new(PoolCache {
+            lists: [NSTD_NULL; CLASS_SIZES.len()],
+        })
+    };
+}
+
+/// Allocates a block of memory on the heap through the current thread's allocation pool.
+///
+/// Allocations of 256 bytes or less are rounded up to a size class and served from the calling
+/// thread's free lists without any cross-thread synchronization, larger allocations fall back to
+/// `nstd_alloc_allocate`. Memory returned by this function must be freed with
+/// `nstd_alloc_pool_deallocate`.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize size` - The number of bytes to allocate on the heap.
+///
+/// # Returns
+///
+/// `NSTDAnyMut ptr` - A pointer to the allocated memory, null on error.
+///
+/// # Safety
+///
+/// This operation is unsafe because the behaviour is undefined if `size` is zero.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_alloc_pool_allocate(size: NSTDUSize) -> NSTDAnyMut {
+    if let Some(class) = class_of(size) {
+        return CACHE.with(|cache| {
+            let mut cache = cache.borrow_mut();
+            let head = cache.lists[class];
+            // Pop a cached block off the class's free list if one is available.
+            if !head.is_null() {
+                cache.lists[class] = core::ptr::read_unaligned(head.cast::<NSTDAnyMut>());
+                return head;
+            }
+            // The free list is empty, allocate a new block of the class's full size so it can be
+            // cached when freed.
+            nstd_alloc_allocate(CLASS_SIZES[class])
+        });
+    }
+    nstd_alloc_allocate(size)
+}
+
+/// Deallocates a block of memory previously allocated by `nstd_alloc_pool_allocate`.
+///
+/// Blocks of 256 bytes or less are cached on the calling thread's free lists for reuse, larger
+/// blocks are returned to the heap immediately.
+///
+/// # Parameters:
+///
+/// - `NSTDAnyMut *ptr` - A pointer to the allocated memory, once freed the pointer is set to null.
+///
+/// - `NSTDUSize size` - The number of bytes that were requested from `nstd_alloc_pool_allocate`.
+///
+/// # Safety
+///
+/// This operation is unsafe because the behaviour is undefined if `ptr` is not a value returned by
+/// `nstd_alloc_pool_allocate`, or `size` does not match the value used for the allocation.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_alloc_pool_deallocate(ptr: &mut NSTDAnyMut, size: NSTDUSize) {
+    if let Some(class) = class_of(size) {
+        CACHE.with(|cache| {
+            let mut cache = cache.borrow_mut();
+            // Push the block onto the class's free list, storing the old head in its first bytes.
+            core::ptr::write_unaligned((*ptr).cast::<NSTDAnyMut>(), cache.lists[class]);
+            cache.lists[class] = *ptr;
+            *ptr = NSTD_NULL;
+        });
+        return;
+    }
+    nstd_alloc_deallocate(ptr, size);
+}
+
+/// Returns the largest allocation size (in bytes) that is served from the pool's free lists.
+///
+/// # Returns
+///
+/// `NSTDUSize size` - The pool's maximum cached allocation size.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_alloc_pool_max_size() -> NSTDUSize {
+    MAX_POOLED_SIZE
+}
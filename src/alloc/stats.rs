@@ -0,0 +1,107 @@
+//! Allocation statistics for `nstd`'s heap allocation functions.
+use crate::{core::def::NSTDErrorCode, NSTDAnyMut, NSTDUSize};
+use core::sync::atomic::{AtomicUsize, Ordering};
+
+/// The number of calls made to the `nstd_alloc_allocate[_zeroed|_aligned]` functions.
+static ALLOCATIONS: AtomicUsize = AtomicUsize::new(0);
+/// The total number of bytes requested from the `nstd_alloc_allocate[_zeroed|_aligned]` functions.
+static ALLOCATED_BYTES: AtomicUsize = AtomicUsize::new(0);
+/// The number of allocations that returned null.
+static ALLOCATION_FAILURES: AtomicUsize = AtomicUsize::new(0);
+/// The number of calls made to the `nstd_alloc_reallocate[_aligned]` functions.
+static REALLOCATIONS: AtomicUsize = AtomicUsize::new(0);
+/// The number of reallocations that failed.
+static REALLOCATION_FAILURES: AtomicUsize = AtomicUsize::new(0);
+/// The number of calls made to the `nstd_alloc_deallocate[_aligned]` functions.
+static DEALLOCATIONS: AtomicUsize = AtomicUsize::new(0);
+/// The total number of bytes released through the `nstd_alloc_deallocate[_aligned]` functions.
+static DEALLOCATED_BYTES: AtomicUsize = AtomicUsize::new(0);
+/// The number of calls made to `nstd_vec_reserve`.
+static VEC_RESERVES: AtomicUsize = AtomicUsize::new(0);
+/// The number of times a vector's capacity was grown automatically to make room for a push.
+static VEC_GROWTHS: AtomicUsize = AtomicUsize::new(0);
+
+/// Records a call to one of the `nstd_alloc_allocate[_zeroed|_aligned]` functions.
+#[inline]
+pub(crate) fn record_allocate(mem: NSTDAnyMut, size: NSTDUSize) {
+    ALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+    match mem.is_null() {
+        true => ALLOCATION_FAILURES.fetch_add(1, Ordering::Relaxed),
+        false => ALLOCATED_BYTES.fetch_add(size, Ordering::Relaxed),
+    };
+}
+
+/// Records a call to one of the `nstd_alloc_reallocate[_aligned]` functions.
+#[inline]
+pub(crate) fn record_reallocate(errc: NSTDErrorCode) {
+    REALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+    if errc != 0 {
+        REALLOCATION_FAILURES.fetch_add(1, Ordering::Relaxed);
+    }
+}
+
+/// Records a call to one of the `nstd_alloc_deallocate[_aligned]` functions.
+#[inline]
+pub(crate) fn record_deallocate(size: NSTDUSize) {
+    DEALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+    DEALLOCATED_BYTES.fetch_add(size, Ordering::Relaxed);
+}
+
+/// Records a call to `nstd_vec_reserve`.
+#[inline]
+#[cfg(feature = "nstd_vec")]
+pub(crate) fn record_vec_reserve() {
+    VEC_RESERVES.fetch_add(1, Ordering::Relaxed);
+}
+
+/// Records an automatic vector capacity growth event.
+#[inline]
+#[cfg(feature = "nstd_vec")]
+pub(crate) fn record_vec_growth() {
+    VEC_GROWTHS.fetch_add(1, Ordering::Relaxed);
+}
+
+/// A snapshot of `nstd`'s global allocation counters.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default, Hash)]
+pub struct NSTDAllocStats {
+    /// The number of calls made to the `nstd_alloc_allocate[_zeroed|_aligned]` functions.
+    pub allocations: NSTDUSize,
+    /// The total number of bytes requested from the allocation functions.
+    pub allocated_bytes: NSTDUSize,
+    /// The number of allocations that returned null.
+    pub allocation_failures: NSTDUSize,
+    /// The number of calls made to the `nstd_alloc_reallocate[_aligned]` functions.
+    pub reallocations: NSTDUSize,
+    /// The number of reallocations that failed.
+    pub reallocation_failures: NSTDUSize,
+    /// The number of calls made to the `nstd_alloc_deallocate[_aligned]` functions.
+    pub deallocations: NSTDUSize,
+    /// The total number of bytes released through the deallocation functions.
+    pub deallocated_bytes: NSTDUSize,
+    /// The number of calls made to `nstd_vec_reserve`.
+    pub vec_reserves: NSTDUSize,
+    /// The number of times a vector's capacity was grown automatically to make room for a push.
+    pub vec_growths: NSTDUSize,
+}
+
+/// Takes a snapshot of `nstd`'s global allocation counters.
+///
+/// The counters are only maintained when `nstd` is built with the `nstd_alloc_stats` feature,
+/// without it the allocation functions are left completely uninstrumented.
+///
+/// # Parameters:
+///
+/// - `NSTDAllocStats *out` - Returns as a snapshot of the allocation counters.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_alloc_stats(out: &mut NSTDAllocStats) {
+    out.allocations = ALLOCATIONS.load(Ordering::Relaxed);
+    out.allocated_bytes = ALLOCATED_BYTES.load(Ordering::Relaxed);
+    out.allocation_failures = ALLOCATION_FAILURES.load(Ordering::Relaxed);
+    out.reallocations = REALLOCATIONS.load(Ordering::Relaxed);
+    out.reallocation_failures = REALLOCATION_FAILURES.load(Ordering::Relaxed);
+    out.deallocations = DEALLOCATIONS.load(Ordering::Relaxed);
+    out.deallocated_bytes = DEALLOCATED_BYTES.load(Ordering::Relaxed);
+    out.vec_reserves = VEC_RESERVES.load(Ordering::Relaxed);
+    out.vec_growths = VEC_GROWTHS.load(Ordering::Relaxed);
+}
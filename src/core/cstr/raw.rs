@@ -1,5 +1,11 @@
 //! Raw C string processing.
-use crate::{core::def::NSTDChar, NSTDBool, NSTDUSize, NSTD_FALSE, NSTD_TRUE};
+use crate::{
+    core::{
+        def::NSTDChar,
+        mem::{contains_zero_byte, WORD_SIZE},
+    },
+    NSTDBool, NSTDUSize, NSTD_FALSE, NSTD_TRUE,
+};
 
 /// Gets the length of a null terminated C string, excluding the null byte.
 ///
@@ -15,10 +21,22 @@ use crate::{core::def::NSTDChar, NSTDBool, NSTDUSize, NSTD_FALSE, NSTD_TRUE};
 ///
 /// The C string's buffer may not be large enough to contain the null byte, resulting in an
 /// incorrect length.
-#[inline]
 #[cfg_attr(feature = "clib", no_mangle)]
 pub unsafe extern "C" fn nstd_core_cstr_raw_len(cstr: *const NSTDChar) -> NSTDUSize {
     let mut i = 0;
+    // Scan byte by byte until the C string's position is aligned on a machine word boundary.
+    while cstr.add(i) as usize % WORD_SIZE != 0 {
+        if *cstr.add(i) == 0 {
+            return i;
+        }
+        i += 1;
+    }
+    // Skip over words that do not contain the null byte. The reads are word aligned, so they can
+    // never cross a page boundary that the C string itself does not.
+    while !contains_zero_byte(*cstr.add(i).cast::<usize>()) {
+        i += WORD_SIZE;
+    }
+    // Scan the word containing the null byte.
     while *cstr.add(i) != 0 {
         i += 1;
     }
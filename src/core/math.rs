@@ -1,7 +1,7 @@
 //! Low level math operations.
 use crate::{
-    NSTDFloat32, NSTDFloat64, NSTDISize, NSTDInt16, NSTDInt32, NSTDInt64, NSTDInt8, NSTDUInt16,
-    NSTDUInt32, NSTDUInt64, NSTDUInt8, NSTDUSize,
+    core::slice::NSTDSliceMut, NSTDFloat32, NSTDFloat64, NSTDISize, NSTDInt16, NSTDInt32,
+    NSTDInt64, NSTDInt8, NSTDUInt16, NSTDUInt32, NSTDUInt64, NSTDUInt8, NSTDUSize,
 };
 
 /// Converts radians to degrees.
@@ -328,3 +328,575 @@ gen_clamp!(
     nstd_core_math_clamp_isize,
     NSTDISize
 );
+
+/// Generates the slice `clamp` functions.
+macro_rules! gen_clamp_slice {
+    (
+        $(#[$meta:meta])*
+        $name: ident, $T: ty
+    ) => {
+        $(#[$meta])*
+        #[cfg_attr(feature = "clib", no_mangle)]
+        pub unsafe extern "C" fn $name(slice: &mut NSTDSliceMut, min: $T, max: $T) {
+            assert!(slice.ptr.size == core::mem::size_of::<$T>());
+            // SAFETY: `slice`'s data is valid for reads & writes of `slice.len` elements.
+            let ptr = slice.ptr.raw.cast::<$T>();
+            let mut i = 0;
+            while i < slice.len {
+                let value = ptr.add(i);
+                value.write_unaligned(value.read_unaligned().clamp(min, max));
+                i += 1;
+            }
+        }
+    };
+}
+gen_clamp_slice!(
+    /// Clamps each value in `slice` to the bounds `min` and `max` in place.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDFloat32`s to clamp.
+    ///
+    /// - `NSTDFloat32 min` - The minimum clamp value.
+    ///
+    /// - `NSTDFloat32 max` - The maximum clamp value.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDFloat32`, `min` > `max`, `min` is
+    /// NaN, or `max` is NaN.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_clamp_slice_f32,
+    NSTDFloat32
+);
+gen_clamp_slice!(
+    /// Clamps each value in `slice` to the bounds `min` and `max` in place.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDFloat64`s to clamp.
+    ///
+    /// - `NSTDFloat64 min` - The minimum clamp value.
+    ///
+    /// - `NSTDFloat64 max` - The maximum clamp value.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDFloat64`, `min` > `max`, `min` is
+    /// NaN, or `max` is NaN.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_clamp_slice_f64,
+    NSTDFloat64
+);
+
+/// Generates the saturating slice arithmetic functions.
+macro_rules! gen_saturating_slice {
+    (
+        $(#[$meta:meta])*
+        $name: ident, $op: ident, $T: ty
+    ) => {
+        $(#[$meta])*
+        #[cfg_attr(feature = "clib", no_mangle)]
+        pub unsafe extern "C" fn $name(slice: &mut NSTDSliceMut, v: $T) {
+            assert!(slice.ptr.size == core::mem::size_of::<$T>());
+            // SAFETY: `slice`'s data is valid for reads & writes of `slice.len` elements.
+            let ptr = slice.ptr.raw.cast::<$T>();
+            let mut i = 0;
+            while i < slice.len {
+                let value = ptr.add(i);
+                value.write_unaligned(value.read_unaligned().$op(v));
+                i += 1;
+            }
+        }
+    };
+}
+gen_saturating_slice!(
+    /// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDUInt8`s to operate on.
+    ///
+    /// - `NSTDUInt8 v` - The value to add to each element.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDUInt8`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_add_slice_u8,
+    saturating_add,
+    NSTDUInt8
+);
+gen_saturating_slice!(
+    /// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDInt8`s to operate on.
+    ///
+    /// - `NSTDInt8 v` - The value to add to each element.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDInt8`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_add_slice_i8,
+    saturating_add,
+    NSTDInt8
+);
+gen_saturating_slice!(
+    /// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDUInt16`s to operate on.
+    ///
+    /// - `NSTDUInt16 v` - The value to add to each element.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDUInt16`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_add_slice_u16,
+    saturating_add,
+    NSTDUInt16
+);
+gen_saturating_slice!(
+    /// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDInt16`s to operate on.
+    ///
+    /// - `NSTDInt16 v` - The value to add to each element.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDInt16`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_add_slice_i16,
+    saturating_add,
+    NSTDInt16
+);
+gen_saturating_slice!(
+    /// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDUInt32`s to operate on.
+    ///
+    /// - `NSTDUInt32 v` - The value to add to each element.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDUInt32`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_add_slice_u32,
+    saturating_add,
+    NSTDUInt32
+);
+gen_saturating_slice!(
+    /// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDInt32`s to operate on.
+    ///
+    /// - `NSTDInt32 v` - The value to add to each element.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDInt32`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_add_slice_i32,
+    saturating_add,
+    NSTDInt32
+);
+gen_saturating_slice!(
+    /// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDUInt64`s to operate on.
+    ///
+    /// - `NSTDUInt64 v` - The value to add to each element.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDUInt64`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_add_slice_u64,
+    saturating_add,
+    NSTDUInt64
+);
+gen_saturating_slice!(
+    /// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDInt64`s to operate on.
+    ///
+    /// - `NSTDInt64 v` - The value to add to each element.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDInt64`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_add_slice_i64,
+    saturating_add,
+    NSTDInt64
+);
+gen_saturating_slice!(
+    /// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDUSize`s to operate on.
+    ///
+    /// - `NSTDUSize v` - The value to add to each element.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDUSize`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_add_slice_usize,
+    saturating_add,
+    NSTDUSize
+);
+gen_saturating_slice!(
+    /// Adds `v` to each value in `slice` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDISize`s to operate on.
+    ///
+    /// - `NSTDISize v` - The value to add to each element.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDISize`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_add_slice_isize,
+    saturating_add,
+    NSTDISize
+);
+gen_saturating_slice!(
+    /// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDUInt8`s to operate on.
+    ///
+    /// - `NSTDUInt8 v` - The value to multiply each element by.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDUInt8`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_mul_slice_u8,
+    saturating_mul,
+    NSTDUInt8
+);
+gen_saturating_slice!(
+    /// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDInt8`s to operate on.
+    ///
+    /// - `NSTDInt8 v` - The value to multiply each element by.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDInt8`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_mul_slice_i8,
+    saturating_mul,
+    NSTDInt8
+);
+gen_saturating_slice!(
+    /// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDUInt16`s to operate on.
+    ///
+    /// - `NSTDUInt16 v` - The value to multiply each element by.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDUInt16`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_mul_slice_u16,
+    saturating_mul,
+    NSTDUInt16
+);
+gen_saturating_slice!(
+    /// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDInt16`s to operate on.
+    ///
+    /// - `NSTDInt16 v` - The value to multiply each element by.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDInt16`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_mul_slice_i16,
+    saturating_mul,
+    NSTDInt16
+);
+gen_saturating_slice!(
+    /// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDUInt32`s to operate on.
+    ///
+    /// - `NSTDUInt32 v` - The value to multiply each element by.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDUInt32`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_mul_slice_u32,
+    saturating_mul,
+    NSTDUInt32
+);
+gen_saturating_slice!(
+    /// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDInt32`s to operate on.
+    ///
+    /// - `NSTDInt32 v` - The value to multiply each element by.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDInt32`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_mul_slice_i32,
+    saturating_mul,
+    NSTDInt32
+);
+gen_saturating_slice!(
+    /// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDUInt64`s to operate on.
+    ///
+    /// - `NSTDUInt64 v` - The value to multiply each element by.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDUInt64`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_mul_slice_u64,
+    saturating_mul,
+    NSTDUInt64
+);
+gen_saturating_slice!(
+    /// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDInt64`s to operate on.
+    ///
+    /// - `NSTDInt64 v` - The value to multiply each element by.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDInt64`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_mul_slice_i64,
+    saturating_mul,
+    NSTDInt64
+);
+gen_saturating_slice!(
+    /// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDUSize`s to operate on.
+    ///
+    /// - `NSTDUSize v` - The value to multiply each element by.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDUSize`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_mul_slice_usize,
+    saturating_mul,
+    NSTDUSize
+);
+gen_saturating_slice!(
+    /// Multiplies each value in `slice` by `v` in place, saturating at the numeric bounds
+    /// instead of overflowing.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDISize`s to operate on.
+    ///
+    /// - `NSTDISize v` - The value to multiply each element by.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDISize`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_saturating_mul_slice_isize,
+    saturating_mul,
+    NSTDISize
+);
+
+/// Generates the fused scale & offset slice functions.
+macro_rules! gen_scale_add_slice {
+    (
+        $(#[$meta:meta])*
+        $name: ident, $T: ty
+    ) => {
+        $(#[$meta])*
+        #[cfg_attr(feature = "clib", no_mangle)]
+        pub unsafe extern "C" fn $name(slice: &mut NSTDSliceMut, scale: $T, offset: $T) {
+            assert!(slice.ptr.size == core::mem::size_of::<$T>());
+            // SAFETY: `slice`'s data is valid for reads & writes of `slice.len` elements.
+            let ptr = slice.ptr.raw.cast::<$T>();
+            let mut i = 0;
+            while i < slice.len {
+                let value = ptr.add(i);
+                value.write_unaligned(value.read_unaligned() * scale + offset);
+                i += 1;
+            }
+        }
+    };
+}
+gen_scale_add_slice!(
+    /// Multiplies each value in `slice` by `scale` and adds `offset` to it in place.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDFloat32`s to scale.
+    ///
+    /// - `NSTDFloat32 scale` - The value to multiply each element by.
+    ///
+    /// - `NSTDFloat32 offset` - The value to add to each element after scaling.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDFloat32`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_scale_add_slice_f32,
+    NSTDFloat32
+);
+gen_scale_add_slice!(
+    /// Multiplies each value in `slice` by `scale` and adds `offset` to it in place.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDSliceMut *slice` - The slice of `NSTDFloat64`s to scale.
+    ///
+    /// - `NSTDFloat64 scale` - The value to multiply each element by.
+    ///
+    /// - `NSTDFloat64 offset` - The value to add to each element after scaling.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `slice`'s element size is not the size of `NSTDFloat64`.
+    ///
+    /// # Safety
+    ///
+    /// This operation can cause undefined behavior if `slice`'s data is invalid.
+    nstd_core_math_scale_add_slice_f64,
+    NSTDFloat64
+);
@@ -1,6 +1,25 @@
 //! Contains mostly unsafe functions for interacting with raw memory.
 use crate::{core::def::NSTDByte, NSTDBool, NSTDUSize, NSTD_TRUE};
 
+/// The number of bytes in a machine word.
+pub(crate) const WORD_SIZE: usize = core::mem::size_of::<usize>();
+
+/// A mask with the least significant bit of each byte in a machine word set.
+pub(crate) const LOW_BITS: usize = usize::MAX / u8::MAX as usize;
+
+/// A mask with the most significant bit of each byte in a machine word set.
+pub(crate) const HIGH_BITS: usize = LOW_BITS * 0x80;
+
+/// Determines whether or not a machine word contains a zero byte.
+///
+/// This uses the well known "haszero" bit trick: subtracting `LOW_BITS` borrows into the high bit
+/// of each byte that was zero, and masking with `!word` filters out bytes that had their high bit
+/// set to begin with.
+#[inline]
+pub(crate) fn contains_zero_byte(word: usize) -> bool {
+    word.wrapping_sub(LOW_BITS) & !word & HIGH_BITS != 0
+}
+
 /// Compares two memory buffers of `num` bytes.
 ///
 /// # Parameters:
@@ -54,11 +73,101 @@ pub unsafe extern "C" fn nstd_core_mem_compare(
 #[inline]
 #[cfg_attr(feature = "clib", no_mangle)]
 pub unsafe extern "C" fn nstd_core_mem_fill(buf: *mut NSTDByte, size: NSTDUSize, fill: NSTDByte) {
+    core::ptr::write_bytes(buf, fill, size);
+}
+
+/// Searches a memory buffer for the first occurrence of `delim`.
+///
+/// Runs of bytes that do not contain `delim` are skipped a machine word at a time.
+///
+/// # Parameters:
+///
+/// - `const NSTDByte *buf` - The memory buffer to search.
+///
+/// - `NSTDUSize size` - The size of the memory buffer.
+///
+/// - `NSTDByte delim` - The byte value to search for.
+///
+/// # Returns
+///
+/// `const NSTDByte *match` - A pointer to the first occurrence of `delim` in `buf`, or null if
+/// the buffer does not contain `delim`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if the caller does not ensure that the memory
+/// buffer is at least `size` bytes in size.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_core_mem_find(
+    buf: *const NSTDByte,
+    size: NSTDUSize,
+    delim: NSTDByte,
+) -> *const NSTDByte {
+    // A word with `delim` in every byte, so a zero byte in `word ^ broadcast` marks a match.
+    let broadcast = LOW_BITS * delim as usize;
     let mut i = 0;
+    while i + WORD_SIZE <= size {
+        let word = buf.add(i).cast::<usize>().read_unaligned();
+        if contains_zero_byte(word ^ broadcast) {
+            break;
+        }
+        i += WORD_SIZE;
+    }
+    // Scan the matching word and/or the remaining bytes.
     while i < size {
-        *buf.add(i) = fill;
+        if *buf.add(i) == delim {
+            return buf.add(i);
+        }
         i += 1;
     }
+    core::ptr::null()
+}
+
+/// Searches a memory buffer for the last occurrence of `delim`.
+///
+/// Runs of bytes that do not contain `delim` are skipped a machine word at a time.
+///
+/// # Parameters:
+///
+/// - `const NSTDByte *buf` - The memory buffer to search.
+///
+/// - `NSTDUSize size` - The size of the memory buffer.
+///
+/// - `NSTDByte delim` - The byte value to search for.
+///
+/// # Returns
+///
+/// `const NSTDByte *match` - A pointer to the last occurrence of `delim` in `buf`, or null if
+/// the buffer does not contain `delim`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if the caller does not ensure that the memory
+/// buffer is at least `size` bytes in size.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_core_mem_rfind(
+    buf: *const NSTDByte,
+    size: NSTDUSize,
+    delim: NSTDByte,
+) -> *const NSTDByte {
+    // A word with `delim` in every byte, so a zero byte in `word ^ broadcast` marks a match.
+    let broadcast = LOW_BITS * delim as usize;
+    let mut i = size;
+    while i >= WORD_SIZE {
+        let word = buf.add(i - WORD_SIZE).cast::<usize>().read_unaligned();
+        if contains_zero_byte(word ^ broadcast) {
+            break;
+        }
+        i -= WORD_SIZE;
+    }
+    // Scan the matching word and/or the remaining bytes.
+    while i > 0 {
+        i -= 1;
+        if *buf.add(i) == delim {
+            return buf.add(i);
+        }
+    }
+    core::ptr::null()
 }
 
 /// Copies `num` bytes from `src` to `dest`.
@@ -1,7 +1,7 @@
 //! A half-open (low inclusive, high exclusive) numerical range.
 use crate::{
-    NSTDFloat32, NSTDFloat64, NSTDISize, NSTDInt16, NSTDInt32, NSTDInt64, NSTDInt8, NSTDUInt16,
-    NSTDUInt32, NSTDUInt64, NSTDUInt8, NSTDUSize,
+    NSTDAnyMut, NSTDFloat32, NSTDFloat64, NSTDISize, NSTDInt16, NSTDInt32, NSTDInt64, NSTDInt8,
+    NSTDUInt16, NSTDUInt32, NSTDUInt64, NSTDUInt8, NSTDUSize,
 };
 
 /// Generates the `NSTD*Range*` structs.
@@ -81,3 +81,50 @@ gen_range_struct!(
     NSTDFRange64,
     NSTDFloat64
 );
+
+/// A function called for each batch of a range.
+///
+/// The first parameter is the batch's sub-range and the second parameter is the user data that
+/// was passed along with the function.
+pub type NSTDURangeForEach = extern "C" fn(NSTDURange, NSTDAnyMut);
+
+/// Invokes `for_each` once per batch of a range instead of once per index, amortizing the
+/// indirect call over whole batches of elements.
+///
+/// Batches are aligned to multiples of `batch_size`: the first batch ends at the next multiple
+/// of `batch_size` and every following batch covers one full multiple, except the last which is
+/// clamped to `range.end`.
+///
+/// # Parameters:
+///
+/// - `NSTDURange range` - The range of indices to cover.
+///
+/// - `NSTDUSize batch_size` - The number of indices in each batch.
+///
+/// - `NSTDURangeForEach for_each` - The function to invoke for each batch.
+///
+/// - `NSTDAnyMut data` - User data to pass along with each batch.
+///
+/// # Panics
+///
+/// This operation will panic if `batch_size` is zero.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_core_range_u_for_each_batched(
+    range: NSTDURange,
+    batch_size: NSTDUSize,
+    for_each: NSTDURangeForEach,
+    data: NSTDAnyMut,
+) {
+    assert!(batch_size != 0);
+    let mut start = range.start;
+    while start < range.end {
+        // The next batch boundary can overflow when `start` lies within `batch_size` of the
+        // maximum index, in which case the final batch simply ends at `range.end`.
+        let end = match start.checked_add(batch_size - start % batch_size) {
+            Some(aligned) => aligned.min(range.end),
+            _ => range.end,
+        };
+        for_each(NSTDURange { start, end }, data);
+        start = end;
+    }
+}
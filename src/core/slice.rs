@@ -1,12 +1,191 @@
 //! A view into a sequence of values in memory.
+#[cfg(feature = "nstd_core_par")]
+#[cfg_attr(doc_cfg, doc(cfg(feature = "nstd_core_par")))]
+pub mod par;
 use crate::{
     core::{
         mem::nstd_core_mem_copy,
         ptr::{nstd_core_ptr_const_new, nstd_core_ptr_mut_new, NSTDPtrConst, NSTDPtrMut},
     },
-    NSTDAnyConst, NSTDAnyMut, NSTDBool, NSTDUSize, NSTD_NULL,
+    NSTDAnyConst, NSTDAnyMut, NSTDBool, NSTDInt32, NSTDUSize, NSTD_NULL,
 };
 
+/// A function used to compare two slice elements.
+///
+/// The first two parameters are pointers to the elements to compare and the third parameter is
+/// the user data that was passed along with the function. The function must return a negative
+/// value if the first element is less than the second, 0 if the two elements are equal, and a
+/// positive value if the first element is greater than the second.
+pub type NSTDSliceCompare = extern "C" fn(NSTDAnyConst, NSTDAnyConst, NSTDAnyMut) -> NSTDInt32;
+
+/// The maximum number of elements that an introsort run will sort with insertion sort.
+const INSERTION_SORT_MAX: usize = 16;
+
+/// Returns a pointer to the element at index `i` in an untyped buffer of `size` byte elements.
+///
+/// # Safety
+///
+/// The element at index `i` must reside within the buffer.
+#[inline]
+unsafe fn elem(base: *mut u8, i: usize, size: usize) -> *mut u8 {
+    base.add(i * size)
+}
+
+/// Swaps the elements at indexes `a` and `b` in an untyped buffer of `size` byte elements.
+///
+/// # Safety
+///
+/// The elements at indexes `a` and `b` must reside within the buffer.
+#[inline]
+unsafe fn swap_elements(base: *mut u8, a: usize, b: usize, size: usize) {
+    if a != b {
+        core::ptr::swap_nonoverlapping(elem(base, a, size), elem(base, b, size), size);
+    }
+}
+
+/// Insertion sorts `len` elements of `size` bytes each in the buffer pointed to by `base`.
+///
+/// # Safety
+///
+/// The buffer must be valid for reads and writes of `len * size` bytes.
+unsafe fn insertion_sort<F>(base: *mut u8, len: usize, size: usize, less: &mut F)
+where
+    F: FnMut(*const u8, *const u8) -> bool,
+{
+    for i in 1..len {
+        let mut j = i;
+        while j > 0 && less(elem(base, j, size), elem(base, j - 1, size)) {
+            swap_elements(base, j, j - 1, size);
+            j -= 1;
+        }
+    }
+}
+
+/// Sifts the element at index `root` down into the binary max-heap occupying the first `end`
+/// elements of the buffer pointed to by `base`.
+///
+/// # Safety
+///
+/// The buffer must be valid for reads and writes of `end * size` bytes.
+unsafe fn sift_down<F>(base: *mut u8, mut root: usize, end: usize, size: usize, less: &mut F)
+where
+    F: FnMut(*const u8, *const u8) -> bool,
+{
+    loop {
+        let mut child = 2 * root + 1;
+        if child >= end {
+            break;
+        }
+        if child + 1 < end && less(elem(base, child, size), elem(base, child + 1, size)) {
+            child += 1;
+        }
+        if !less(elem(base, root, size), elem(base, child, size)) {
+            break;
+        }
+        swap_elements(base, root, child, size);
+        root = child;
+    }
+}
+
+/// Heap sorts `len` elements of `size` bytes each in the buffer pointed to by `base`.
+///
+/// This is used as introsort's fallback when quicksort's recursion gets too deep.
+///
+/// # Safety
+///
+/// The buffer must be valid for reads and writes of `len * size` bytes.
+unsafe fn heapsort<F>(base: *mut u8, len: usize, size: usize, less: &mut F)
+where
+    F: FnMut(*const u8, *const u8) -> bool,
+{
+    for root in (0..len / 2).rev() {
+        sift_down(base, root, len, size, less);
+    }
+    for end in (1..len).rev() {
+        swap_elements(base, 0, end, size);
+        sift_down(base, 0, end, size, less);
+    }
+}
+
+/// Introsorts `len` elements of `size` bytes each in the buffer pointed to by `base`.
+///
+/// This is a quicksort with median-of-three pivot selection that switches to insertion sort for
+/// small runs and to heap sort when the recursion depth exceeds `depth`, keeping the worst case
+/// at `O(n * log(n))` without allocating any additional memory.
+///
+/// # Safety
+///
+/// The buffer must be valid for reads and writes of `len * size` bytes.
+unsafe fn introsort<F>(mut base: *mut u8, mut len: usize, size: usize, mut depth: u32, less: &mut F)
+where
+    F: FnMut(*const u8, *const u8) -> bool,
+{
+    while len > INSERTION_SORT_MAX {
+        if depth == 0 {
+            return heapsort(base, len, size, less);
+        }
+        depth -= 1;
+        // Move the median of the first, middle and last elements into the pivot (last) position.
+        let (mid, last) = (len / 2, len - 1);
+        if less(elem(base, mid, size), elem(base, 0, size)) {
+            swap_elements(base, mid, 0, size);
+        }
+        if less(elem(base, last, size), elem(base, 0, size)) {
+            swap_elements(base, last, 0, size);
+        }
+        if less(elem(base, mid, size), elem(base, last, size)) {
+            swap_elements(base, mid, last, size);
+        }
+        // Partition the run around the pivot.
+        let pivot = elem(base, last, size);
+        let mut store = 0;
+        for i in 0..last {
+            if less(elem(base, i, size), pivot) {
+                swap_elements(base, i, store, size);
+                store += 1;
+            }
+        }
+        swap_elements(base, store, last, size);
+        // Recurse into the smaller partition and loop on the larger one to bound stack usage.
+        let right = len - store - 1;
+        if store < right {
+            introsort(base, store, size, depth, less);
+            base = elem(base, store + 1, size);
+            len = right;
+        } else {
+            introsort(elem(base, store + 1, size), right, size, depth, less);
+            len = store;
+        }
+    }
+    insertion_sort(base, len, size, less);
+}
+
+/// Sorts a slice's elements in place with the `less` comparison closure.
+///
+/// # Safety
+///
+/// The slice's data must be valid for reads and writes.
+unsafe fn sort_slice<F>(slice: &mut NSTDSliceMut, less: &mut F)
+where
+    F: FnMut(*const u8, *const u8) -> bool,
+{
+    let depth = 2 * (usize::BITS - slice.len.leading_zeros());
+    introsort(slice.ptr.raw.cast(), slice.len, slice.ptr.size, depth, less);
+}
+
+/// Sorts a slice's elements in place as native integer keys of type `T`.
+///
+/// # Safety
+///
+/// The slice's data must be valid for reads and writes and it's element size must match the size
+/// of `T`.
+#[inline]
+unsafe fn sort_keys<T: Copy + PartialOrd>(slice: &mut NSTDSliceMut) {
+    sort_slice(slice, &mut |a: *const u8, b: *const u8| {
+        a.cast::<T>().read_unaligned() < b.cast::<T>().read_unaligned()
+    });
+}
+
 /// An immutable view into a sequence of values in memory.
 #[repr(C)]
 #[derive(Clone, Copy, Debug, Hash)]
@@ -162,6 +341,58 @@ pub unsafe extern "C" fn nstd_core_slice_const_compare(
     (s1.as_slice() == s2.as_slice()).into()
 }
 
+/// Searches a sorted slice for an element that compares equal to `value`.
+///
+/// # Note
+///
+/// `slice` must be sorted by `comparator`, otherwise the result of this operation is unspecified.
+/// If the slice contains multiple elements that compare equal to `value`, a pointer to any one of
+/// them may be returned.
+///
+/// # Parameters:
+///
+/// - `const NSTDSliceConst *slice` - The sorted slice to search.
+///
+/// - `NSTDAnyConst value` - A pointer to the value to search for.
+///
+/// - `NSTDSliceCompare comparator` - The comparison function that the slice is sorted by. The
+/// function is called with a pointer to an element of `slice` as it's first parameter and `value`
+/// as it's second.
+///
+/// - `NSTDAnyMut ctx` - User data to pass to the comparator on each call.
+///
+/// # Returns
+///
+/// `NSTDAnyConst element` - A pointer to an element that compares equal to `value`, or
+/// `NSTD_NULL` if the slice does not contain such an element.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_core_slice_const_binary_search(
+    slice: &NSTDSliceConst,
+    value: NSTDAnyConst,
+    comparator: NSTDSliceCompare,
+    ctx: NSTDAnyMut,
+) -> NSTDAnyConst {
+    let base = slice.ptr.raw.cast::<u8>();
+    let (mut lo, mut hi) = (0, slice.len);
+    while lo < hi {
+        let mid = lo + (hi - lo) / 2;
+        let element = base.add(mid * slice.ptr.size);
+        let order = comparator(element.cast(), value, ctx);
+        if order < 0 {
+            lo = mid + 1;
+        } else if order > 0 {
+            hi = mid;
+        } else {
+            return element.cast();
+        }
+    }
+    core::ptr::null()
+}
+
 /// A view into a sequence of values in memory.
 #[repr(C)]
 #[derive(Clone, Copy, Debug, Hash)]
@@ -388,3 +619,89 @@ pub unsafe extern "C" fn nstd_core_slice_mut_copy(dest: &mut NSTDSliceMut, src:
     assert!(dest.byte_len() >= src.byte_len());
     nstd_core_mem_copy(dest.ptr.raw.cast(), src.ptr.raw.cast(), src.byte_len());
 }
+
+/// Sorts a slice's elements in place using `comparator`.
+///
+/// This is an unstable introsort, the relative order of elements that compare equal is not
+/// preserved and no additional memory is allocated.
+///
+/// # Note
+///
+/// If `comparator` does not implement a total order over the slice's elements, the order of the
+/// sorted slice is unspecified.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice to sort.
+///
+/// - `NSTDSliceCompare comparator` - The comparison function to sort the slice's elements by.
+///
+/// - `NSTDAnyMut ctx` - User data to pass to the comparator on each call.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_core_slice_mut_sort(
+    slice: &mut NSTDSliceMut,
+    comparator: NSTDSliceCompare,
+    ctx: NSTDAnyMut,
+) {
+    sort_slice(slice, &mut |a: *const u8, b: *const u8| {
+        comparator(a.cast(), b.cast(), ctx) < 0
+    });
+}
+
+/// Sorts a slice of signed integers in place in ascending order.
+///
+/// This avoids `nstd_core_slice_mut_sort`'s indirect comparator call for the common integer key
+/// widths, the elements are compared directly as native signed integers instead.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of signed integers to sort.
+///
+/// # Panics
+///
+/// This function will panic if `slice`'s element size is not 1, 2, 4 or 8.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_core_slice_mut_sort_signed(slice: &mut NSTDSliceMut) {
+    match slice.ptr.size {
+        1 => sort_keys::<i8>(slice),
+        2 => sort_keys::<i16>(slice),
+        4 => sort_keys::<i32>(slice),
+        8 => sort_keys::<i64>(slice),
+        size => panic!("unsupported integer key size of {size} bytes"),
+    }
+}
+
+/// Sorts a slice of unsigned integers in place in ascending order.
+///
+/// This avoids `nstd_core_slice_mut_sort`'s indirect comparator call for the common integer key
+/// widths, the elements are compared directly as native unsigned integers instead.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice of unsigned integers to sort.
+///
+/// # Panics
+///
+/// This function will panic if `slice`'s element size is not 1, 2, 4 or 8.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `slice`'s data is invalid.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_core_slice_mut_sort_unsigned(slice: &mut NSTDSliceMut) {
+    match slice.ptr.size {
+        1 => sort_keys::<u8>(slice),
+        2 => sort_keys::<u16>(slice),
+        4 => sort_keys::<u32>(slice),
+        8 => sort_keys::<u64>(slice),
+        size => panic!("unsupported integer key size of {size} bytes"),
+    }
+}
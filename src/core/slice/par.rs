@@ -0,0 +1,198 @@
+//! Parallel operations over slices.
+use crate::{
+    core::slice::{NSTDSliceConst, NSTDSliceMut},
+    NSTDAnyConst, NSTDAnyMut,
+};
+use std::thread;
+
+/// The byte alignment that parallel partition boundaries are rounded to.
+///
+/// Keeping each worker's partition on it's own cache lines prevents false sharing between the
+/// worker threads.
+const PARTITION_ALIGN: usize = 64;
+
+/// The minimum number of elements a worker must receive for a parallel operation to spawn worker
+/// threads.
+const MIN_ELEMENTS_PER_WORKER: usize = 1024;
+
+/// A function to be called for each element in a slice.
+///
+/// The first parameter is a pointer to the element and the second parameter is the user data that
+/// was passed along with the function.
+pub type NSTDSliceParForEach = extern "C" fn(NSTDAnyMut, NSTDAnyMut);
+
+/// A function that folds a slice element into an accumulator.
+///
+/// The first parameter is a pointer to the accumulator, the second parameter is a pointer to the
+/// element to fold into the accumulator and the third parameter is the user data that was passed
+/// along with the function.
+pub type NSTDSliceParReduce = extern "C" fn(NSTDAnyMut, NSTDAnyConst, NSTDAnyMut);
+
+/// A raw pointer that may be sent to a worker thread.
+#[derive(Clone, Copy)]
+struct SendPtr(NSTDAnyMut);
+impl SendPtr {
+    /// Returns the raw pointer.
+    ///
+    /// Worker closures access the pointer through this method so that they capture the [SendPtr]
+    /// itself instead of it's non-[Send] field.
+    #[inline]
+    const fn get(self) -> NSTDAnyMut {
+        self.0
+    }
+}
+// SAFETY: The caller of a parallel operation guarantees that the pointer's data is safe to access
+// from other threads.
+unsafe impl Send for SendPtr {}
+
+/// Returns the number of workers to use for a parallel operation over `len` elements.
+#[inline]
+fn worker_count(len: usize) -> usize {
+    let workers = thread::available_parallelism().map_or(1, |workers| workers.get());
+    workers.min(len / MIN_ELEMENTS_PER_WORKER).max(1)
+}
+
+/// Returns the number of elements each worker's partition of a slice should contain.
+///
+/// Partition boundaries are rounded up to cache line multiples when the element size allows it.
+fn partition_len(len: usize, size: usize, workers: usize) -> usize {
+    let per_worker = (len + workers - 1) / workers;
+    let align = match size > 0 && PARTITION_ALIGN % size == 0 {
+        true => PARTITION_ALIGN / size,
+        false => 1,
+    };
+    ((per_worker + align - 1) / align * align).max(1)
+}
+
+/// Calls `callback` with a pointer to each element in a slice, splitting the work across a pool
+/// of worker threads.
+///
+/// The slice is partitioned across the machine's available hardware threads on cache line aligned
+/// boundaries, small slices are processed on the calling thread. The call returns once every
+/// element has been visited.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *slice` - The slice to operate on.
+///
+/// - `NSTDSliceParForEach callback` - The function to call for each element in the slice.
+///
+/// - `NSTDAnyMut ctx` - User data to pass to the callback on each call.
+///
+/// # Safety
+///
+/// - `slice`'s data must be valid for reads and writes.
+///
+/// - `callback` is called from multiple threads at once, both the callback and `ctx`'s data must
+/// be safe to use concurrently.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_core_slice_par_for_each(
+    slice: &mut NSTDSliceMut,
+    callback: NSTDSliceParForEach,
+    ctx: NSTDAnyMut,
+) {
+    let (len, size) = (slice.len, slice.ptr.size);
+    let workers = worker_count(len);
+    if workers <= 1 {
+        let mut ptr = slice.ptr.raw.cast::<u8>();
+        for _ in 0..len {
+            callback(ptr.cast(), ctx);
+            ptr = ptr.add(size);
+        }
+        return;
+    }
+    let partition = partition_len(len, size, workers);
+    let base = SendPtr(slice.ptr.raw);
+    let ctx = SendPtr(ctx);
+    thread::scope(|scope| {
+        let mut start = 0;
+        while start < len {
+            let end = (start + partition).min(len);
+            scope.spawn(move || {
+                // SAFETY: Each worker visits it's own partition of the slice's elements.
+                unsafe {
+                    let mut ptr = base.get().cast::<u8>().add(start * size);
+                    for _ in start..end {
+                        callback(ptr.cast(), ctx.get());
+                        ptr = ptr.add(size);
+                    }
+                }
+            });
+            start = end;
+        }
+    });
+}
+
+/// Folds each element in a slice into one of `accums`' accumulators, splitting the work across a
+/// pool of worker threads.
+///
+/// The slice is partitioned into up to `accums.len` partitions on cache line aligned boundaries
+/// and each partition's worker folds the partition's elements into it's own accumulator, in
+/// order. The accumulators must be initialized by the caller, accumulators that receive no
+/// elements are left untouched. Once the call returns the caller can combine the accumulators
+/// into the final result.
+///
+/// # Parameters:
+///
+/// - `const NSTDSliceConst *slice` - The slice to operate on.
+///
+/// - `NSTDSliceMut *accums` - A slice of accumulators, one for each worker to use.
+///
+/// - `NSTDSliceParReduce callback` - The function that folds an element into an accumulator.
+///
+/// - `NSTDAnyMut ctx` - User data to pass to the callback on each call.
+///
+/// # Panics
+///
+/// This function will panic if `accums` is empty.
+///
+/// # Safety
+///
+/// - `slice` and `accums`' data must be valid for reads and writes respectively.
+///
+/// - `callback` is called from multiple threads at once, both the callback and `ctx`'s data must
+/// be safe to use concurrently.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_core_slice_par_reduce(
+    slice: &NSTDSliceConst,
+    accums: &mut NSTDSliceMut,
+    callback: NSTDSliceParReduce,
+    ctx: NSTDAnyMut,
+) {
+    assert!(accums.len > 0);
+    let (len, size) = (slice.len, slice.ptr.size);
+    let workers = accums.len.min(worker_count(len));
+    if workers <= 1 {
+        let mut ptr = slice.ptr.raw.cast::<u8>();
+        for _ in 0..len {
+            callback(accums.ptr.raw, ptr.cast(), ctx);
+            ptr = ptr.add(size);
+        }
+        return;
+    }
+    let partition = partition_len(len, size, workers);
+    let base = SendPtr(slice.ptr.raw as NSTDAnyMut);
+    let accum_base = SendPtr(accums.ptr.raw);
+    let accum_size = accums.ptr.size;
+    let ctx = SendPtr(ctx);
+    thread::scope(|scope| {
+        let (mut start, mut worker) = (0, 0);
+        while start < len {
+            let end = (start + partition).min(len);
+            scope.spawn(move || {
+                // SAFETY: Each worker visits it's own partition of the slice's elements and folds
+                // them into it's own accumulator.
+                unsafe {
+                    let accum = accum_base.get().cast::<u8>().add(worker * accum_size);
+                    let mut ptr = base.get().cast::<u8>().add(start * size);
+                    for _ in start..end {
+                        callback(accum.cast(), ptr.cast(), ctx.get());
+                        ptr = ptr.add(size);
+                    }
+                }
+            });
+            start = end;
+            worker += 1;
+        }
+    });
+}
@@ -9,11 +9,156 @@ use crate::{
         range::NSTDURange,
         slice::{nstd_core_slice_const_new, nstd_core_slice_mut_new, NSTDSliceConst, NSTDSliceMut},
     },
-    NSTDFloat32, NSTDFloat64, NSTDISize, NSTDInt16, NSTDInt32, NSTDInt64, NSTDInt8, NSTDUInt16,
-    NSTDUInt32, NSTDUInt64, NSTDUInt8, NSTDUSize, NSTDUnichar,
+    NSTDBool, NSTDFloat32, NSTDFloat64, NSTDISize, NSTDInt16, NSTDInt32, NSTDInt64, NSTDInt8,
+    NSTDUInt16, NSTDUInt32, NSTDUInt64, NSTDUInt8, NSTDUSize, NSTDUnichar, NSTD_NULL,
 };
 
-/// Generates the `nstd_core_str_*_to_[i|u|f]*` functions.
+/// The number of bytes in a machine word.
+const WORD_SIZE: usize = core::mem::size_of::<usize>();
+
+/// A mask with the most significant bit of each byte in a machine word set.
+const HIGH_BITS: usize = usize::MAX / u8::MAX as usize * 0x80;
+
+/// Determines whether or not `bytes` are valid UTF-8.
+///
+/// Runs of ASCII bytes are skipped a machine word at a time before falling back to `core`'s UTF-8
+/// validation for the remainder. UTF-8 is self-synchronizing, so the bytes following a run of
+/// ASCII bytes are valid UTF-8 if and only if the whole sequence is. This makes validating the
+/// mostly-ASCII payloads commonly seen in practice much cheaper than walking them byte by byte.
+fn validate_utf8(bytes: &[u8]) -> bool {
+    let mut i = 0;
+    while i + WORD_SIZE <= bytes.len() {
+        // SAFETY: There are at least `WORD_SIZE` bytes at offset `i`.
+        let word = unsafe { bytes.as_ptr().add(i).cast::<usize>().read_unaligned() };
+        if word & HIGH_BITS != 0 {
+            break;
+        }
+        i += WORD_SIZE;
+    }
+    core::str::from_utf8(&bytes[i..]).is_ok()
+}
+
+/// Returns `true` if all eight bytes of `chunk` (in little-endian byte order) are ASCII digits.
+#[inline]
+const fn is_eight_digits(chunk: u64) -> bool {
+    ((chunk & 0xF0F0F0F0F0F0F0F0)
+        | ((chunk.wrapping_add(0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4))
+        == 0x3333333333333333
+}
+
+/// Converts a chunk of eight ASCII digits (in little-endian byte order) into it's numerical
+/// value.
+///
+/// SWAR multiplies combine adjacent digits into pairs, the pairs into quads and the quads into
+/// the final value, converting all eight digits in three multiplications. The multiplications
+/// operate on multiple digits packed into one word, bits carried out of a digit's lane are
+/// discarded by the masks so the wrapping arithmetic is intentional.
+#[inline]
+const fn parse_eight_digits(mut chunk: u64) -> u64 {
+    chunk -= 0x3030303030303030;
+    chunk = chunk.wrapping_mul(10).wrapping_add(chunk >> 8);
+    ((chunk & 0x000000FF000000FF)
+        .wrapping_mul(0x000F424000000064)
+        .wrapping_add(((chunk >> 16) & 0x000000FF000000FF).wrapping_mul(0x0000271000000001)))
+        >> 32
+}
+
+/// Parses an unsigned 64-bit integer from a run of ASCII digits, eight digits at a time.
+///
+/// Returns `None` if `bytes` is empty, contains a non-digit byte or the parsed value overflows.
+fn parse_unsigned(bytes: &[u8]) -> Option<u64> {
+    if bytes.is_empty() {
+        return None;
+    }
+    let (mut i, mut v) = (0, 0u64);
+    while bytes.len() - i >= 8 {
+        // SAFETY: There are at least 8 bytes at offset `i`.
+        let chunk = u64::from_le(unsafe { bytes.as_ptr().add(i).cast::<u64>().read_unaligned() });
+        if !is_eight_digits(chunk) {
+            break;
+        }
+        v = v
+            .checked_mul(100_000_000)?
+            .checked_add(parse_eight_digits(chunk))?;
+        i += 8;
+    }
+    for byte in &bytes[i..] {
+        let digit = byte.wrapping_sub(b'0');
+        if digit > 9 {
+            return None;
+        }
+        v = v.checked_mul(10)?.checked_add(digit as u64)?;
+    }
+    Some(v)
+}
+
+/// Generates the `nstd_core_str_*_to_u*` functions.
+macro_rules! gen_to_unsigned {
+    (
+        $(#[$meta:meta])*
+        $name: ident, $StrT: ty, $RetT: ty
+    ) => {
+        $(#[$meta])*
+        ///
+        /// # Safety:
+        ///
+        /// This operation can cause undefined behavior if `str`'s data is invalid.
+        #[cfg_attr(feature = "clib", no_mangle)]
+        pub unsafe extern "C" fn $name(str: &$StrT, errc: &mut NSTDErrorCode) -> $RetT {
+            let bytes = str.as_str().as_bytes();
+            let digits = match bytes.first() {
+                Some(b'+') => &bytes[1..],
+                _ => bytes,
+            };
+            if let Some(v) = parse_unsigned(digits) {
+                // A `match` instead of `if let` here, the conversion is infallible when the
+                // return type is `NSTDUInt64`.
+                match <$RetT>::try_from(v) {
+                    Ok(v) => return v,
+                    _ => (),
+                }
+            }
+            *errc = 1;
+            <$RetT>::default()
+        }
+    };
+}
+
+/// Generates the `nstd_core_str_*_to_i*` functions.
+macro_rules! gen_to_signed {
+    (
+        $(#[$meta:meta])*
+        $name: ident, $StrT: ty, $RetT: ty
+    ) => {
+        $(#[$meta])*
+        ///
+        /// # Safety:
+        ///
+        /// This operation can cause undefined behavior if `str`'s data is invalid.
+        #[cfg_attr(feature = "clib", no_mangle)]
+        pub unsafe extern "C" fn $name(str: &$StrT, errc: &mut NSTDErrorCode) -> $RetT {
+            let bytes = str.as_str().as_bytes();
+            let (neg, digits) = match bytes.first() {
+                Some(b'-') => (true, &bytes[1..]),
+                Some(b'+') => (false, &bytes[1..]),
+                _ => (false, bytes),
+            };
+            if let Some(v) = parse_unsigned(digits) {
+                let v = match neg {
+                    true => -(v as i128),
+                    false => v as i128,
+                };
+                if let Ok(v) = <$RetT>::try_from(v) {
+                    return v;
+                }
+            }
+            *errc = 1;
+            <$RetT>::default()
+        }
+    };
+}
+
+/// Generates the `nstd_core_str_*_to_f*` functions.
 macro_rules! gen_to_primitive {
     (
         $(#[$meta:meta])*
@@ -55,6 +200,16 @@ impl NSTDStrConst {
     }
 }
 
+/// An iterator over the characters of an `NSTDStrConst`.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Hash)]
+pub struct NSTDStrConstChars {
+    /// The string slice being iterated over.
+    str: NSTDStrConst,
+    /// The byte offset of the next character to decode.
+    offset: NSTDUSize,
+}
+
 /// Creates a new instance of `NSTDStrConst` from a C string slice.
 ///
 /// # Parameters:
@@ -73,7 +228,10 @@ impl NSTDStrConst {
 pub extern "C" fn nstd_core_str_const_from_cstr(cstr: &NSTDCStrConst) -> NSTDStrConst {
     let bytes = nstd_core_cstr_const_as_bytes(cstr);
     // SAFETY: The returned string slice is already unsafe to access.
-    core::str::from_utf8(unsafe { bytes.as_slice() }).expect("Invalid UTF-8 bytes");
+    assert!(
+        validate_utf8(unsafe { bytes.as_slice() }),
+        "Invalid UTF-8 bytes"
+    );
     NSTDStrConst { bytes }
 }
 
@@ -119,12 +277,51 @@ pub unsafe extern "C" fn nstd_core_str_const_from_cstr_unchecked(
 pub extern "C" fn nstd_core_str_const_from_bytes(bytes: &NSTDSliceConst) -> NSTDStrConst {
     assert!(bytes.ptr.size == 1);
     // SAFETY: The returned string slice is already unsafe to access.
-    core::str::from_utf8(unsafe { bytes.as_slice() }).expect("Invalid UTF-8 bytes");
+    assert!(
+        validate_utf8(unsafe { bytes.as_slice() }),
+        "Invalid UTF-8 bytes"
+    );
     NSTDStrConst {
         bytes: nstd_core_slice_const_new(bytes.ptr.raw, bytes.ptr.size, bytes.len),
     }
 }
 
+/// Attempts to create a string slice from raw bytes.
+///
+/// Unlike `nstd_core_str_const_from_bytes` this will not panic if `bytes` is not valid UTF-8,
+/// making it suitable for validating untrusted input without unwinding across the FFI boundary.
+///
+/// # Parameters:
+///
+/// - `const NSTDSliceConst *bytes` - The UTF-8 encoded byte slice.
+///
+/// - `NSTDErrorCode *errc` - Set to nonzero if `bytes` is not valid UTF-8.
+///
+/// # Returns
+///
+/// `NSTDStrConst str` - The new string slice, or an empty string slice on error.
+///
+/// # Panics
+///
+/// This operation will panic if `bytes.ptr.size` is not 1.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_core_str_const_try_from_bytes(
+    bytes: &NSTDSliceConst,
+    errc: &mut NSTDErrorCode,
+) -> NSTDStrConst {
+    assert!(bytes.ptr.size == 1);
+    // SAFETY: The returned string slice is already unsafe to access.
+    if validate_utf8(unsafe { bytes.as_slice() }) {
+        return NSTDStrConst {
+            bytes: nstd_core_slice_const_new(bytes.ptr.raw, bytes.ptr.size, bytes.len),
+        };
+    }
+    *errc = 1;
+    NSTDStrConst {
+        bytes: nstd_core_slice_const_new(NSTD_NULL, 1, 0),
+    }
+}
+
 /// Creates a string slice from raw bytes, without checking for UTF-8.
 ///
 /// # Parameters:
@@ -220,6 +417,78 @@ pub unsafe extern "C" fn nstd_core_str_const_get_char(
     }
 }
 
+/// Creates an iterator over the characters of a string slice.
+///
+/// # Parameters:
+///
+/// - `const NSTDStrConst *str` - The string slice to iterate over.
+///
+/// # Returns
+///
+/// `NSTDStrConstChars chars` - The new character iterator, referencing `str`'s data.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_core_str_const_chars(str: &NSTDStrConst) -> NSTDStrConstChars {
+    NSTDStrConstChars {
+        str: *str,
+        offset: 0,
+    }
+}
+
+/// Decodes the next character in a character iterator.
+///
+/// Characters are decoded forward in place without copying, allocating or re-validating the
+/// string slice's data, with a single-byte fast path for ASCII characters.
+///
+/// # Parameters:
+///
+/// - `NSTDStrConstChars *chars` - The character iterator.
+///
+/// - `NSTDUnichar *chr` - Returns as the decoded character.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero if the iterator has been exhausted.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if the iterator's string slice data is invalid.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_core_str_const_chars_next(
+    chars: &mut NSTDStrConstChars,
+    chr: &mut NSTDUnichar,
+) -> NSTDErrorCode {
+    if chars.offset >= chars.str.bytes.len {
+        return 1;
+    }
+    let ptr = chars.str.bytes.ptr.raw.cast::<u8>();
+    // SAFETY: `offset` is within the string slice's boundaries.
+    let first = *ptr.add(chars.offset);
+    // ASCII fast path, the character is it's single byte.
+    if first < 0x80 {
+        chars.offset += 1;
+        *chr = first as NSTDUnichar;
+        return 0;
+    }
+    // Decode a multi-byte character. The string slice's data is valid UTF-8, so the leading
+    // byte's prefix determines the character's width and each continuation byte carries six bits.
+    let width = match first {
+        0xC0..=0xDF => 2,
+        0xE0..=0xEF => 3,
+        _ => 4,
+    };
+    let mut code = (first & (0x7F >> width)) as NSTDUnichar;
+    let mut i = 1;
+    while i < width {
+        // SAFETY: A valid multi-byte character never extends past the end of the slice.
+        code = (code << 6) | (*ptr.add(chars.offset + i) & 0x3F) as NSTDUnichar;
+        i += 1;
+    }
+    chars.offset += width;
+    *chr = code;
+    0
+}
+
 /// Creates a substring of an existing string slice.
 ///
 /// # Note
@@ -261,6 +530,126 @@ pub extern "C" fn nstd_core_str_const_substr(
     nstd_core_str_const_from_bytes(&bytes)
 }
 
+/// Searches a string slice for the first occurrence of a pattern.
+///
+/// # Parameters:
+///
+/// - `const NSTDStrConst *str` - The string slice to search.
+///
+/// - `const NSTDStrConst *pattern` - The substring to search for.
+///
+/// - `NSTDErrorCode *errc` - Set to nonzero if `str` does not contain `pattern`.
+///
+/// # Returns
+///
+/// `NSTDURange range` - The byte range of the first match, suitable for
+/// `nstd_core_str_const_substr`, or an empty range on error.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `str` or `pattern`'s data is invalid.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_core_str_const_find(
+    str: &NSTDStrConst,
+    pattern: &NSTDStrConst,
+    errc: &mut NSTDErrorCode,
+) -> NSTDURange {
+    match str.as_str().find(pattern.as_str()) {
+        Some(start) => NSTDURange {
+            start,
+            end: start + pattern.bytes.len,
+        },
+        _ => {
+            *errc = 1;
+            NSTDURange { start: 0, end: 0 }
+        }
+    }
+}
+
+/// Searches a string slice for the last occurrence of a pattern.
+///
+/// # Parameters:
+///
+/// - `const NSTDStrConst *str` - The string slice to search.
+///
+/// - `const NSTDStrConst *pattern` - The substring to search for.
+///
+/// - `NSTDErrorCode *errc` - Set to nonzero if `str` does not contain `pattern`.
+///
+/// # Returns
+///
+/// `NSTDURange range` - The byte range of the last match, suitable for
+/// `nstd_core_str_const_substr`, or an empty range on error.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `str` or `pattern`'s data is invalid.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_core_str_const_rfind(
+    str: &NSTDStrConst,
+    pattern: &NSTDStrConst,
+    errc: &mut NSTDErrorCode,
+) -> NSTDURange {
+    match str.as_str().rfind(pattern.as_str()) {
+        Some(start) => NSTDURange {
+            start,
+            end: start + pattern.bytes.len,
+        },
+        _ => {
+            *errc = 1;
+            NSTDURange { start: 0, end: 0 }
+        }
+    }
+}
+
+/// Determines whether or not a string slice begins with a pattern.
+///
+/// # Parameters:
+///
+/// - `const NSTDStrConst *str` - The string slice to check.
+///
+/// - `const NSTDStrConst *pattern` - The substring to check for.
+///
+/// # Returns
+///
+/// `NSTDBool starts_with` - `NSTD_TRUE` if `str` begins with `pattern`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `str` or `pattern`'s data is invalid.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_core_str_const_starts_with(
+    str: &NSTDStrConst,
+    pattern: &NSTDStrConst,
+) -> NSTDBool {
+    str.as_str().starts_with(pattern.as_str()).into()
+}
+
+/// Determines whether or not a string slice ends with a pattern.
+///
+/// # Parameters:
+///
+/// - `const NSTDStrConst *str` - The string slice to check.
+///
+/// - `const NSTDStrConst *pattern` - The substring to check for.
+///
+/// # Returns
+///
+/// `NSTDBool ends_with` - `NSTD_TRUE` if `str` ends with `pattern`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `str` or `pattern`'s data is invalid.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_core_str_const_ends_with(
+    str: &NSTDStrConst,
+    pattern: &NSTDStrConst,
+) -> NSTDBool {
+    str.as_str().ends_with(pattern.as_str()).into()
+}
+
 gen_to_primitive!(
     /// Attempts to parse a string slice as an `NSTDFloat32`.
     ///
@@ -293,7 +682,7 @@ gen_to_primitive!(
     NSTDStrConst,
     NSTDFloat64
 );
-gen_to_primitive!(
+gen_to_unsigned!(
     /// Attempts to parse a string slice as an `NSTDUInt8`.
     ///
     /// # Parameters:
@@ -309,7 +698,7 @@ gen_to_primitive!(
     NSTDStrConst,
     NSTDUInt8
 );
-gen_to_primitive!(
+gen_to_signed!(
     /// Attempts to parse a string slice as an `NSTDInt8`.
     ///
     /// # Parameters:
@@ -325,7 +714,7 @@ gen_to_primitive!(
     NSTDStrConst,
     NSTDInt8
 );
-gen_to_primitive!(
+gen_to_unsigned!(
     /// Attempts to parse a string slice as an `NSTDUInt16`.
     ///
     /// # Parameters:
@@ -341,7 +730,7 @@ gen_to_primitive!(
     NSTDStrConst,
     NSTDUInt16
 );
-gen_to_primitive!(
+gen_to_signed!(
     /// Attempts to parse a string slice as an `NSTDInt16`.
     ///
     /// # Parameters:
@@ -357,7 +746,7 @@ gen_to_primitive!(
     NSTDStrConst,
     NSTDInt16
 );
-gen_to_primitive!(
+gen_to_unsigned!(
     /// Attempts to parse a string slice as an `NSTDUInt32`.
     ///
     /// # Parameters:
@@ -373,7 +762,7 @@ gen_to_primitive!(
     NSTDStrConst,
     NSTDUInt32
 );
-gen_to_primitive!(
+gen_to_signed!(
     /// Attempts to parse a string slice as an `NSTDInt32`.
     ///
     /// # Parameters:
@@ -389,7 +778,7 @@ gen_to_primitive!(
     NSTDStrConst,
     NSTDInt32
 );
-gen_to_primitive!(
+gen_to_unsigned!(
     /// Attempts to parse a string slice as an `NSTDUInt64`.
     ///
     /// # Parameters:
@@ -405,7 +794,7 @@ gen_to_primitive!(
     NSTDStrConst,
     NSTDUInt64
 );
-gen_to_primitive!(
+gen_to_signed!(
     /// Attempts to parse a string slice as an `NSTDInt64`.
     ///
     /// # Parameters:
@@ -421,7 +810,7 @@ gen_to_primitive!(
     NSTDStrConst,
     NSTDInt64
 );
-gen_to_primitive!(
+gen_to_unsigned!(
     /// Attempts to parse a string slice as an `NSTDUSize`.
     ///
     /// # Parameters:
@@ -437,7 +826,7 @@ gen_to_primitive!(
     NSTDStrConst,
     NSTDUSize
 );
-gen_to_primitive!(
+gen_to_signed!(
     /// Attempts to parse a string slice as an `NSTDISize`.
     ///
     /// # Parameters:
@@ -493,7 +882,10 @@ pub extern "C" fn nstd_core_str_mut_from_cstr(cstr: &mut NSTDCStrMut) -> NSTDStr
     let len = nstd_core_cstr_mut_len(cstr);
     let bytes = nstd_core_slice_mut_new(ptr.cast(), 1, len);
     // SAFETY: The returned string slice is already unsafe to access.
-    core::str::from_utf8(unsafe { bytes.as_slice() }).expect("Invalid UTF-8 bytes");
+    assert!(
+        validate_utf8(unsafe { bytes.as_slice() }),
+        "Invalid UTF-8 bytes"
+    );
     NSTDStrMut { bytes }
 }
 
@@ -541,12 +933,51 @@ pub unsafe extern "C" fn nstd_core_str_mut_from_cstr_unchecked(
 pub extern "C" fn nstd_core_str_mut_from_bytes(bytes: &mut NSTDSliceMut) -> NSTDStrMut {
     assert!(bytes.ptr.size == 1);
     // SAFETY: The returned string slice is already unsafe to access.
-    core::str::from_utf8(unsafe { bytes.as_slice() }).expect("Invalid UTF-8 bytes");
+    assert!(
+        validate_utf8(unsafe { bytes.as_slice() }),
+        "Invalid UTF-8 bytes"
+    );
     NSTDStrMut {
         bytes: nstd_core_slice_mut_new(bytes.ptr.raw, bytes.ptr.size, bytes.len),
     }
 }
 
+/// Attempts to create a string slice from raw bytes.
+///
+/// Unlike `nstd_core_str_mut_from_bytes` this will not panic if `bytes` is not valid UTF-8,
+/// making it suitable for validating untrusted input without unwinding across the FFI boundary.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceMut *bytes` - The UTF-8 encoded byte slice.
+///
+/// - `NSTDErrorCode *errc` - Set to nonzero if `bytes` is not valid UTF-8.
+///
+/// # Returns
+///
+/// `NSTDStrMut str` - The new string slice, or an empty string slice on error.
+///
+/// # Panics
+///
+/// This operation will panic if `bytes.ptr.size` is not 1.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_core_str_mut_try_from_bytes(
+    bytes: &mut NSTDSliceMut,
+    errc: &mut NSTDErrorCode,
+) -> NSTDStrMut {
+    assert!(bytes.ptr.size == 1);
+    // SAFETY: The returned string slice is already unsafe to access.
+    if validate_utf8(unsafe { bytes.as_slice() }) {
+        return NSTDStrMut {
+            bytes: nstd_core_slice_mut_new(bytes.ptr.raw, bytes.ptr.size, bytes.len),
+        };
+    }
+    *errc = 1;
+    NSTDStrMut {
+        bytes: nstd_core_slice_mut_new(NSTD_NULL, 1, 0),
+    }
+}
+
 /// Creates a string slice from raw bytes, without checking for UTF-8.
 ///
 /// # Parameters:
@@ -712,7 +1143,7 @@ gen_to_primitive!(
     NSTDStrMut,
     NSTDFloat64
 );
-gen_to_primitive!(
+gen_to_unsigned!(
     /// Attempts to parse a string slice as an `NSTDUInt8`.
     ///
     /// # Parameters:
@@ -728,7 +1159,7 @@ gen_to_primitive!(
     NSTDStrMut,
     NSTDUInt8
 );
-gen_to_primitive!(
+gen_to_signed!(
     /// Attempts to parse a string slice as an `NSTDInt8`.
     ///
     /// # Parameters:
@@ -744,7 +1175,7 @@ gen_to_primitive!(
     NSTDStrMut,
     NSTDInt8
 );
-gen_to_primitive!(
+gen_to_unsigned!(
     /// Attempts to parse a string slice as an `NSTDUInt16`.
     ///
     /// # Parameters:
@@ -760,7 +1191,7 @@ gen_to_primitive!(
     NSTDStrMut,
     NSTDUInt16
 );
-gen_to_primitive!(
+gen_to_signed!(
     /// Attempts to parse a string slice as an `NSTDInt16`.
     ///
     /// # Parameters:
@@ -776,7 +1207,7 @@ gen_to_primitive!(
     NSTDStrMut,
     NSTDInt16
 );
-gen_to_primitive!(
+gen_to_unsigned!(
     /// Attempts to parse a string slice as an `NSTDUInt32`.
     ///
     /// # Parameters:
@@ -792,7 +1223,7 @@ gen_to_primitive!(
     NSTDStrMut,
     NSTDUInt32
 );
-gen_to_primitive!(
+gen_to_signed!(
     /// Attempts to parse a string slice as an `NSTDInt32`.
     ///
     /// # Parameters:
@@ -808,7 +1239,7 @@ gen_to_primitive!(
     NSTDStrMut,
     NSTDInt32
 );
-gen_to_primitive!(
+gen_to_unsigned!(
     /// Attempts to parse a string slice as an `NSTDUInt64`.
     ///
     /// # Parameters:
@@ -824,7 +1255,7 @@ gen_to_primitive!(
     NSTDStrMut,
     NSTDUInt64
 );
-gen_to_primitive!(
+gen_to_signed!(
     /// Attempts to parse a string slice as an `NSTDInt64`.
     ///
     /// # Parameters:
@@ -840,7 +1271,7 @@ gen_to_primitive!(
     NSTDStrMut,
     NSTDInt64
 );
-gen_to_primitive!(
+gen_to_unsigned!(
     /// Attempts to parse a string slice as an `NSTDUSize`.
     ///
     /// # Parameters:
@@ -856,7 +1287,7 @@ gen_to_primitive!(
     NSTDStrMut,
     NSTDUSize
 );
-gen_to_primitive!(
+gen_to_signed!(
     /// Attempts to parse a string slice as an `NSTDISize`.
     ///
     /// # Parameters:
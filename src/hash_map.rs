@@ -0,0 +1,477 @@
+//! An unordered associative container with untyped keys and values.
+//!
+//! The map is implemented with open addressing and linear probing over a single flat buffer, so
+//! inserting an entry never allocates on it's own and lookups stay cache friendly. Keys are
+//! hashed by their raw bytes, making the map suitable for any key type with a unique byte
+//! representation.
+use crate::{
+    alloc::{nstd_alloc_allocate_zeroed, nstd_alloc_deallocate},
+    core::{
+        def::{NSTDByte, NSTDErrorCode},
+        mem::{nstd_core_mem_compare, nstd_core_mem_copy},
+    },
+    NSTDAnyConst, NSTDAnyMut, NSTDUSize, NSTD_FALSE, NSTD_NULL,
+};
+
+/// The state of a bucket that has never held an entry.
+const EMPTY: NSTDByte = 0;
+
+/// The state of a bucket that holds an entry.
+const FULL: NSTDByte = 1;
+
+/// The state of a bucket whose entry has been removed.
+const TOMBSTONE: NSTDByte = 2;
+
+/// The number of buckets allocated for a map's first table.
+const DEFAULT_CAP: usize = 8;
+
+/// The FNV-1a hash offset basis.
+const FNV_OFFSET: u64 = 0xCBF29CE484222325;
+
+/// The FNV-1a hash prime.
+const FNV_PRIME: u64 = 0x100000001B3;
+
+/// A function to be called for each entry in a hash map.
+///
+/// The first parameter is a pointer to the entry's key, the second parameter is a pointer to the
+/// entry's value and the third parameter is the user data that was passed along with the
+/// function.
+pub type NSTDHashMapForEach = extern "C" fn(NSTDAnyConst, NSTDAnyMut, NSTDAnyMut);
+
+/// An unordered associative container with untyped keys and values.
+#[repr(C)]
+#[derive(Debug, Hash)]
+pub struct NSTDHashMap {
+    /// A pointer to the map's bucket buffer.
+    buffer: NSTDAnyMut,
+    /// The size in bytes of the map's keys.
+    key_size: NSTDUSize,
+    /// The size in bytes of the map's values.
+    value_size: NSTDUSize,
+    /// The number of buckets in the map's bucket buffer.
+    cap: NSTDUSize,
+    /// The number of entries in the map.
+    len: NSTDUSize,
+    /// The number of buckets holding a removed entry's tombstone.
+    tombstones: NSTDUSize,
+}
+impl NSTDHashMap {
+    /// Returns the size (in bytes) of a single bucket.
+    ///
+    /// Each bucket holds a one byte state followed by an entry's key and value.
+    #[inline]
+    fn bucket_size(&self) -> usize {
+        1 + self.key_size + self.value_size
+    }
+
+    /// Returns a pointer to the bucket at index `i`.
+    ///
+    /// # Safety
+    ///
+    /// `i` must be less than the number of buckets in the map.
+    #[inline]
+    unsafe fn bucket(&self, i: usize) -> *mut NSTDByte {
+        self.buffer.cast::<NSTDByte>().add(i * self.bucket_size())
+    }
+
+    /// Computes the FNV-1a hash of `key` and maps it to a bucket index.
+    ///
+    /// # Safety
+    ///
+    /// `key` must point to at least `self.key_size` bytes of initialized memory.
+    unsafe fn bucket_index(&self, key: *const NSTDByte) -> usize {
+        let mut hash = FNV_OFFSET;
+        let mut i = 0;
+        while i < self.key_size {
+            hash ^= *key.add(i) as u64;
+            hash = hash.wrapping_mul(FNV_PRIME);
+            i += 1;
+        }
+        // The number of buckets is always a power of two.
+        hash as usize & (self.cap - 1)
+    }
+
+    /// Returns a pointer to the bucket holding `key`, or null if the map does not contain `key`.
+    ///
+    /// # Safety
+    ///
+    /// `key` must point to at least `self.key_size` bytes of initialized memory.
+    unsafe fn find(&self, key: *const NSTDByte) -> *mut NSTDByte {
+        if self.len == 0 {
+            return core::ptr::null_mut();
+        }
+        let mut i = self.bucket_index(key);
+        loop {
+            let bucket = self.bucket(i);
+            match *bucket {
+                EMPTY => return core::ptr::null_mut(),
+                FULL if nstd_core_mem_compare(bucket.add(1), key, self.key_size) != NSTD_FALSE => {
+                    return bucket
+                }
+                _ => i = (i + 1) & (self.cap - 1),
+            }
+        }
+    }
+
+    /// Grows the map's bucket buffer to `new_cap` buckets, rehashing every entry.
+    ///
+    /// `new_cap` must be a power of two large enough to hold the map's entries.
+    fn grow(&mut self, new_cap: usize) -> NSTDErrorCode {
+        let bucket_size = self.bucket_size();
+        // Allocate the new bucket buffer, zeroed memory marks every bucket as empty.
+        // SAFETY: The allocation size is never zero.
+        let buffer = unsafe { nstd_alloc_allocate_zeroed(new_cap * bucket_size) };
+        if buffer.is_null() {
+            return 1;
+        }
+        // Rehash the map's entries into the new bucket buffer.
+        let old = core::mem::replace(&mut self.buffer, buffer);
+        let old_cap = core::mem::replace(&mut self.cap, new_cap);
+        for i in 0..old_cap {
+            // SAFETY: `i` is a valid index into the old bucket buffer.
+            unsafe {
+                let bucket = old.cast::<NSTDByte>().add(i * bucket_size);
+                if *bucket == FULL {
+                    let mut j = self.bucket_index(bucket.add(1));
+                    while *self.bucket(j) == FULL {
+                        j = (j + 1) & (new_cap - 1);
+                    }
+                    nstd_core_mem_copy(self.bucket(j), bucket, bucket_size);
+                }
+            }
+        }
+        // Free the old bucket buffer. Only full buckets were rehashed, so the new bucket buffer
+        // is free of tombstones.
+        self.tombstones = 0;
+        if !old.is_null() {
+            let mut old = old;
+            // SAFETY: The old bucket buffer is non-null.
+            unsafe { nstd_alloc_deallocate(&mut old, old_cap * bucket_size) };
+        }
+        0
+    }
+}
+impl Drop for NSTDHashMap {
+    /// [NSTDHashMap]'s destructor.
+    #[inline]
+    fn drop(&mut self) {
+        if !self.buffer.is_null() {
+            let buffer_size = self.cap * self.bucket_size();
+            // SAFETY: The map's bucket buffer is non-null.
+            unsafe { nstd_alloc_deallocate(&mut self.buffer, buffer_size) };
+        }
+    }
+}
+
+/// Creates a new hash map without allocating any resources.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize key_size` - The size in bytes of the map's keys.
+///
+/// - `NSTDUSize value_size` - The size in bytes of the map's values.
+///
+/// # Returns
+///
+/// `NSTDHashMap map` - The new hash map.
+///
+/// # Panics
+///
+/// This function will panic if either `key_size` or `value_size` are zero.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_hash_map_new(key_size: NSTDUSize, value_size: NSTDUSize) -> NSTDHashMap {
+    assert!(key_size != 0);
+    assert!(value_size != 0);
+    NSTDHashMap {
+        buffer: NSTD_NULL,
+        key_size,
+        value_size,
+        cap: 0,
+        len: 0,
+        tombstones: 0,
+    }
+}
+
+/// Creates a new hash map initialized with the given capacity.
+///
+/// # Note
+///
+/// This will return a map without any allocated buckets on error.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize key_size` - The size in bytes of the map's keys.
+///
+/// - `NSTDUSize value_size` - The size in bytes of the map's values.
+///
+/// - `NSTDUSize cap` - The number of entries to preallocate space for.
+///
+/// # Returns
+///
+/// `NSTDHashMap map` - The new hash map.
+///
+/// # Panics
+///
+/// This function will panic if either `key_size`, `value_size`, or `cap` are zero.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_hash_map_new_with_cap(
+    key_size: NSTDUSize,
+    value_size: NSTDUSize,
+    cap: NSTDUSize,
+) -> NSTDHashMap {
+    assert!(cap != 0);
+    let mut map = nstd_hash_map_new(key_size, value_size);
+    // Allocate at least enough power-of-two buckets to hold `cap` entries below the maximum load
+    // factor of 3/4.
+    let mut buckets = DEFAULT_CAP;
+    while buckets * 3 / 4 < cap {
+        buckets *= 2;
+    }
+    map.grow(buckets);
+    map
+}
+
+/// Returns the number of entries in a hash map.
+///
+/// # Parameters:
+///
+/// - `const NSTDHashMap *map` - The hash map.
+///
+/// # Returns
+///
+/// `NSTDUSize len` - The number of entries in the hash map.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_hash_map_len(map: &NSTDHashMap) -> NSTDUSize {
+    map.len
+}
+
+/// Inserts an entry into a hash map, overwriting the previous value if the map already contained
+/// the entry's key.
+///
+/// # Parameters:
+///
+/// - `NSTDHashMap *map` - The hash map.
+///
+/// - `NSTDAnyConst key` - A pointer to the entry's key.
+///
+/// - `NSTDAnyConst value` - A pointer to the entry's value.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero if allocating for the map's bucket buffer fails.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if the sizes of the key and value being inserted
+/// do not match `map`'s key and value sizes.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_hash_map_insert(
+    map: &mut NSTDHashMap,
+    key: NSTDAnyConst,
+    value: NSTDAnyConst,
+) -> NSTDErrorCode {
+    // Grow the bucket buffer if the insertion would push the number of occupied (full or
+    // tombstone) buckets over a load factor of 3/4, so at least one empty bucket always
+    // survives for probe loops to terminate on.
+    if map.cap == 0 || (map.len + map.tombstones + 1) * 4 > map.cap * 3 {
+        let new_cap = match map.cap {
+            0 => DEFAULT_CAP,
+            // Rehash in place when the map's entries alone fit below the load factor, this
+            // reclaims tombstoned buckets without growing the table.
+            cap if (map.len + 1) * 4 <= cap * 3 => cap,
+            cap => cap * 2,
+        };
+        let errc = map.grow(new_cap);
+        if errc != 0 {
+            return errc;
+        }
+    }
+    // Probe for the key's bucket, reusing the first tombstone on the probe path if the map does
+    // not already contain the key.
+    let key = key.cast::<NSTDByte>();
+    let mut tombstone = core::ptr::null_mut::<NSTDByte>();
+    let mut i = map.bucket_index(key);
+    let bucket = loop {
+        let bucket = map.bucket(i);
+        match *bucket {
+            EMPTY => {
+                break match tombstone.is_null() {
+                    true => bucket,
+                    false => tombstone,
+                }
+            }
+            FULL if nstd_core_mem_compare(bucket.add(1), key, map.key_size) != NSTD_FALSE => {
+                // The map already contains the key, overwrite the entry's value.
+                nstd_core_mem_copy(bucket.add(1 + map.key_size), value.cast(), map.value_size);
+                return 0;
+            }
+            TOMBSTONE if tombstone.is_null() => {
+                tombstone = bucket;
+                i = (i + 1) & (map.cap - 1);
+            }
+            _ => i = (i + 1) & (map.cap - 1),
+        }
+    };
+    // Write the new entry.
+    if *bucket == TOMBSTONE {
+        map.tombstones -= 1;
+    }
+    *bucket = FULL;
+    nstd_core_mem_copy(bucket.add(1), key, map.key_size);
+    nstd_core_mem_copy(bucket.add(1 + map.key_size), value.cast(), map.value_size);
+    map.len += 1;
+    0
+}
+
+/// Returns an immutable pointer to the value of the entry with key `key` in `map`.
+///
+/// # Note
+///
+/// It is highly advised to copy the return value onto the stack because the pointer can easily
+/// become invalid if the map is mutated.
+///
+/// # Parameters:
+///
+/// - `const NSTDHashMap *map` - The hash map.
+///
+/// - `NSTDAnyConst key` - A pointer to the key of the entry to retrieve.
+///
+/// # Returns
+///
+/// `NSTDAnyConst value` - A pointer to the entry's value, or null if the map does not contain
+/// `key`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if the size of the key does not match `map`'s key
+/// size.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_hash_map_get(map: &NSTDHashMap, key: NSTDAnyConst) -> NSTDAnyConst {
+    let bucket = map.find(key.cast());
+    match bucket.is_null() {
+        true => NSTD_NULL,
+        false => bucket.add(1 + map.key_size).cast(),
+    }
+}
+
+/// Returns a pointer to the value of the entry with key `key` in `map`.
+///
+/// # Note
+///
+/// It is highly advised to copy the return value onto the stack because the pointer can easily
+/// become invalid if the map is mutated.
+///
+/// # Parameters:
+///
+/// - `NSTDHashMap *map` - The hash map.
+///
+/// - `NSTDAnyConst key` - A pointer to the key of the entry to retrieve.
+///
+/// # Returns
+///
+/// `NSTDAnyMut value` - A pointer to the entry's value, or null if the map does not contain
+/// `key`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if the size of the key does not match `map`'s key
+/// size.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_hash_map_get_mut(
+    map: &mut NSTDHashMap,
+    key: NSTDAnyConst,
+) -> NSTDAnyMut {
+    nstd_hash_map_get(map, key) as NSTDAnyMut
+}
+
+/// Removes the entry with key `key` from a hash map.
+///
+/// # Parameters:
+///
+/// - `NSTDHashMap *map` - The hash map.
+///
+/// - `NSTDAnyConst key` - A pointer to the key of the entry to remove.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero if the map does not contain `key`.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if the size of the key does not match `map`'s key
+/// size.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_hash_map_remove(
+    map: &mut NSTDHashMap,
+    key: NSTDAnyConst,
+) -> NSTDErrorCode {
+    let bucket = map.find(key.cast());
+    if bucket.is_null() {
+        return 1;
+    }
+    // Mark the bucket as a tombstone so probe paths through it stay intact.
+    *bucket = TOMBSTONE;
+    map.len -= 1;
+    map.tombstones += 1;
+    0
+}
+
+/// Calls `callback` with the key and value of each entry in a hash map.
+///
+/// The order in which the entries are visited is unspecified.
+///
+/// # Parameters:
+///
+/// - `NSTDHashMap *map` - The hash map.
+///
+/// - `NSTDHashMapForEach callback` - The function to call for each entry in the map.
+///
+/// - `NSTDAnyMut ctx` - User data to pass to the callback on each call.
+///
+/// # Safety
+///
+/// The callback must not insert into or remove from the map.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_hash_map_for_each(
+    map: &mut NSTDHashMap,
+    callback: NSTDHashMapForEach,
+    ctx: NSTDAnyMut,
+) {
+    for i in 0..map.cap {
+        let bucket = map.bucket(i);
+        if *bucket == FULL {
+            let key = bucket.add(1);
+            callback(key.cast(), key.add(map.key_size).cast(), ctx);
+        }
+    }
+}
+
+/// Removes all entries from a hash map, keeping it's bucket buffer.
+///
+/// # Parameters:
+///
+/// - `NSTDHashMap *map` - The hash map to clear.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_hash_map_clear(map: &mut NSTDHashMap) {
+    for i in 0..map.cap {
+        // SAFETY: `i` is a valid index into the map's bucket buffer.
+        unsafe { *map.bucket(i) = EMPTY };
+    }
+    map.len = 0;
+    map.tombstones = 0;
+}
+
+/// Frees an instance of `NSTDHashMap`.
+///
+/// # Parameters:
+///
+/// - `NSTDHashMap map` - The hash map to free.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+#[allow(unused_variables)]
+pub extern "C" fn nstd_hash_map_free(map: NSTDHashMap) {}
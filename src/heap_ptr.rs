@@ -5,8 +5,10 @@ use crate::{
         mem::nstd_core_mem_copy,
         ptr::{nstd_core_ptr_mut_new, NSTDPtrMut},
     },
-    NSTDAnyConst, NSTDAnyMut, NSTDUSize,
+    NSTDAnyConst, NSTDAnyMut, NSTDUSize, NSTD_NULL,
 };
+#[cfg(feature = "nstd_vec")]
+use crate::core::slice::nstd_core_slice_mut_new;
 
 /// A pointer type for single value heap allocation.
 #[repr(C)]
@@ -15,11 +17,23 @@ pub struct NSTDHeapPtr {
     /// A pointer to the value on the heap.
     ptr: NSTDPtrMut,
 }
+impl NSTDHeapPtr {
+    /// Constructs a new [NSTDHeapPtr] that takes ownership of an existing heap allocation.
+    #[inline]
+    #[cfg(feature = "nstd_vec")]
+    pub(crate) fn from_raw(ptr: NSTDPtrMut) -> Self {
+        Self { ptr }
+    }
+}
 impl Drop for NSTDHeapPtr {
     /// [NSTDHeapPtr]'s destructor.
     #[inline]
     fn drop(&mut self) {
-        unsafe { nstd_alloc_deallocate(&mut self.ptr.raw, self.ptr.size) };
+        // The heap pointer may have had it's allocation moved out by `nstd_heap_ptr_take`.
+        if !self.ptr.raw.is_null() {
+            // SAFETY: The heap object's buffer is non-null.
+            unsafe { nstd_alloc_deallocate(&mut self.ptr.raw, self.ptr.size) };
+        }
     }
 }
 
@@ -105,6 +119,53 @@ pub extern "C" fn nstd_heap_ptr_clone(hptr: &NSTDHeapPtr) -> NSTDHeapPtr {
     }
 }
 
+/// Takes ownership of a heap object's allocation, leaving the original heap pointer empty.
+///
+/// This transfers the payload without allocating or copying. The emptied heap pointer no longer
+/// owns an object (it's size becomes zero and it's data becomes null), but it may still be safely
+/// freed.
+///
+/// # Parameters:
+///
+/// - `NSTDHeapPtr *hptr` - The heap pointer to take the allocation from.
+///
+/// # Returns
+///
+/// `NSTDHeapPtr taken` - A new heap pointer that owns the allocation.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_heap_ptr_take(hptr: &mut NSTDHeapPtr) -> NSTDHeapPtr {
+    let empty = NSTDHeapPtr {
+        ptr: nstd_core_ptr_mut_new(NSTD_NULL, 0),
+    };
+    core::mem::replace(hptr, empty)
+}
+
+/// Returns ownership of an `NSTDHeapPtr`'s allocation as a byte vector, taking ownership of said
+/// heap pointer.
+///
+/// This transfers the payload without allocating or copying, the returned vector reuses the heap
+/// object's buffer.
+///
+/// # Parameters:
+///
+/// - `NSTDHeapPtr hptr` - The heap pointer.
+///
+/// # Returns
+///
+/// `NSTDVec bytes` - A byte vector that owns the heap object's data.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+#[cfg(feature = "nstd_vec")]
+#[cfg_attr(doc_cfg, doc(cfg(feature = "nstd_vec")))]
+pub extern "C" fn nstd_heap_ptr_into_vec(hptr: NSTDHeapPtr) -> crate::vec::NSTDVec {
+    let mut hptr = core::mem::ManuallyDrop::new(hptr);
+    let buffer = nstd_core_slice_mut_new(hptr.ptr.raw, 1, hptr.ptr.size);
+    hptr.ptr.raw = NSTD_NULL;
+    // SAFETY: The buffer was allocated by the `nstd_alloc` functions and is fully initialized.
+    unsafe { crate::vec::NSTDVec::from_buffer(buffer) }
+}
+
 /// Returns the size of the heap allocated object.
 ///
 /// # Parameters:
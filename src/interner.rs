@@ -0,0 +1,344 @@
+//! A deduplicating string pool.
+//!
+//! Interning a string stores one copy of it's bytes in a large shared slab and hands back a
+//! stable `NSTDStrConst` view along with a compact integer id. Interning a string that the pool
+//! already contains is a hash lookup that never allocates and returns the existing id, so holding
+//! millions of duplicate short strings (symbols, header names, etc.) costs one allocation per
+//! unique string and string equality becomes an integer compare.
+use crate::{
+    alloc::{nstd_alloc_allocate, nstd_alloc_allocate_zeroed, nstd_alloc_deallocate},
+    core::{
+        def::NSTDErrorCode,
+        mem::{nstd_core_mem_compare, nstd_core_mem_copy},
+        slice::nstd_core_slice_const_new,
+        str::{
+            nstd_core_str_const_as_bytes, nstd_core_str_const_from_bytes_unchecked, NSTDStrConst,
+        },
+    },
+    vec::{nstd_vec_get, nstd_vec_get_mut, nstd_vec_len, nstd_vec_new, nstd_vec_push, NSTDVec},
+    NSTDAnyConst, NSTDAnyMut, NSTDUSize, NSTD_FALSE, NSTD_NULL,
+};
+use core::mem::size_of;
+
+/// The size in bytes of each slab allocated by an interner.
+const SLAB_SIZE: usize = 65536;
+
+/// The number of slots allocated for an interner's first hash table.
+const DEFAULT_TABLE_CAP: usize = 64;
+
+/// The FNV-1a hash offset basis.
+const FNV_OFFSET: u64 = 0xCBF29CE484222325;
+
+/// The FNV-1a hash prime.
+const FNV_PRIME: u64 = 0x100000001B3;
+
+/// The size in bytes of a hash table slot.
+const SLOT_SIZE: usize = size_of::<NSTDUSize>();
+
+/// Computes the FNV-1a hash of `bytes`.
+fn fnv1a(bytes: &[u8]) -> u64 {
+    let mut hash = FNV_OFFSET;
+    for byte in bytes {
+        hash ^= *byte as u64;
+        hash = hash.wrapping_mul(FNV_PRIME);
+    }
+    hash
+}
+
+/// A slab of memory holding the bytes of an interner's unique strings.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Hash)]
+struct Slab {
+    /// A pointer to the slab's memory.
+    ptr: NSTDAnyMut,
+    /// The number of bytes in use.
+    len: NSTDUSize,
+    /// The slab's capacity in bytes.
+    cap: NSTDUSize,
+}
+
+/// A deduplicating string pool.
+#[repr(C)]
+#[derive(Debug, Hash)]
+pub struct NSTDInterner {
+    /// The list of slabs holding the interned strings' bytes.
+    slabs: NSTDVec,
+    /// Each interned string's view, indexed by it's id.
+    views: NSTDVec,
+    /// The hash table mapping string hashes to ids, each slot holds an id plus one or 0 if the
+    /// slot is empty.
+    table: NSTDAnyMut,
+    /// The number of slots in the hash table, always a power of two.
+    table_cap: NSTDUSize,
+}
+impl NSTDInterner {
+    /// Reads the view with id `id`.
+    ///
+    /// # Safety
+    ///
+    /// `id` must be less than the number of interned strings.
+    #[inline]
+    unsafe fn view(&self, id: usize) -> NSTDStrConst {
+        // The view list is byte aligned, so the view must be read unaligned.
+        nstd_vec_get(&self.views, id)
+            .cast::<NSTDStrConst>()
+            .read_unaligned()
+    }
+
+    /// Returns a pointer to the hash table slot at index `i`.
+    ///
+    /// # Safety
+    ///
+    /// `i` must be less than the number of slots in the hash table.
+    #[inline]
+    unsafe fn slot(&self, i: usize) -> *mut NSTDUSize {
+        self.table.cast::<NSTDUSize>().add(i)
+    }
+
+    /// Grows the interner's hash table to `new_cap` slots, rehashing every interned string.
+    ///
+    /// `new_cap` must be a power of two large enough to hold every interned string's id.
+    fn grow_table(&mut self, new_cap: usize) -> NSTDErrorCode {
+        // Allocate the new table, zeroed memory marks every slot as empty.
+        // SAFETY: The allocation size is never zero.
+        let table = unsafe { nstd_alloc_allocate_zeroed(new_cap * SLOT_SIZE) };
+        if table.is_null() {
+            return 1;
+        }
+        let old_table = core::mem::replace(&mut self.table, table);
+        let old_cap = core::mem::replace(&mut self.table_cap, new_cap);
+        // Rehash each interned string into the new table.
+        for id in 0..nstd_vec_len(&self.views) {
+            // SAFETY: `id` is within the view list's boundaries.
+            let view = unsafe { self.view(id) };
+            // SAFETY: The view's data lives in the interner's slabs.
+            let hash = fnv1a(unsafe { nstd_core_str_const_as_bytes(&view).as_slice() });
+            let mut i = hash as usize & (new_cap - 1);
+            // SAFETY: The table has more slots than interned strings, so probing always finds an
+            // empty slot.
+            unsafe {
+                while *self.slot(i) != 0 {
+                    i = (i + 1) & (new_cap - 1);
+                }
+                *self.slot(i) = id + 1;
+            }
+        }
+        if !old_table.is_null() {
+            let mut old_table = old_table;
+            // SAFETY: The old table was allocated with `old_cap * SLOT_SIZE` bytes.
+            unsafe { nstd_alloc_deallocate(&mut old_table, old_cap * SLOT_SIZE) };
+        }
+        0
+    }
+}
+impl Drop for NSTDInterner {
+    /// [NSTDInterner]'s destructor.
+    fn drop(&mut self) {
+        for i in 0..nstd_vec_len(&self.slabs) {
+            // SAFETY: `i` is within the slab list's boundaries, the slab list is byte aligned so
+            // the slab must be read unaligned.
+            let mut slab = unsafe { nstd_vec_get(&self.slabs, i).cast::<Slab>().read_unaligned() };
+            // SAFETY: The slab was allocated with `nstd_alloc_allocate`.
+            unsafe { nstd_alloc_deallocate(&mut slab.ptr, slab.cap) };
+        }
+        if !self.table.is_null() {
+            // SAFETY: The table was allocated with `table_cap * SLOT_SIZE` bytes.
+            unsafe { nstd_alloc_deallocate(&mut self.table, self.table_cap * SLOT_SIZE) };
+        }
+    }
+}
+
+/// Creates a new empty string interner.
+///
+/// # Returns
+///
+/// `NSTDInterner interner` - The new string interner.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_interner_new() -> NSTDInterner {
+    NSTDInterner {
+        slabs: nstd_vec_new(size_of::<Slab>()),
+        views: nstd_vec_new(size_of::<NSTDStrConst>()),
+        table: NSTD_NULL,
+        table_cap: 0,
+    }
+}
+
+/// Returns the number of unique strings in an interner.
+///
+/// # Parameters:
+///
+/// - `const NSTDInterner *interner` - The string interner.
+///
+/// # Returns
+///
+/// `NSTDUSize len` - The number of unique strings in the interner.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_interner_len(interner: &NSTDInterner) -> NSTDUSize {
+    nstd_vec_len(&interner.views)
+}
+
+/// Interns a string, returning it's id.
+///
+/// If the interner already contains `str` this is a hash lookup that never allocates and the
+/// existing id is returned, so two interned strings are equal if and only if their ids are equal.
+/// Otherwise the string's bytes are copied into one of the interner's slabs and a new id is
+/// created.
+///
+/// # Parameters:
+///
+/// - `NSTDInterner *interner` - The string interner.
+///
+/// - `const NSTDStrConst *str` - The string to intern.
+///
+/// - `NSTDErrorCode *errc` - Set to nonzero on allocation failure.
+///
+/// # Returns
+///
+/// `NSTDUSize id` - The interned string's id.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `str`'s data is invalid.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_interner_intern(
+    interner: &mut NSTDInterner,
+    str: &NSTDStrConst,
+    errc: &mut NSTDErrorCode,
+) -> NSTDUSize {
+    let bytes = nstd_core_str_const_as_bytes(str);
+    let hash = fnv1a(bytes.as_slice());
+    // Look the string up in the hash table.
+    if interner.table_cap > 0 {
+        let mut i = hash as usize & (interner.table_cap - 1);
+        loop {
+            // SAFETY: `i` is always within the table's boundaries.
+            let slot = *interner.slot(i);
+            if slot == 0 {
+                break;
+            }
+            let view = interner.view(slot - 1);
+            let view_bytes = nstd_core_str_const_as_bytes(&view);
+            if view_bytes.len == bytes.len
+                && nstd_core_mem_compare(view_bytes.ptr.raw.cast(), bytes.ptr.raw.cast(), bytes.len)
+                    != NSTD_FALSE
+            {
+                return slot - 1;
+            }
+            i = (i + 1) & (interner.table_cap - 1);
+        }
+    }
+    // Grow the hash table when it's three quarters full.
+    let len = nstd_vec_len(&interner.views);
+    if (len + 1) * 4 > interner.table_cap * 3 {
+        let new_cap = (interner.table_cap * 2).max(DEFAULT_TABLE_CAP);
+        if interner.grow_table(new_cap) != 0 {
+            *errc = 1;
+            return 0;
+        }
+    }
+    // Copy the string's bytes into a slab.
+    let mut ptr: NSTDAnyConst = NSTD_NULL;
+    if bytes.len > 0 {
+        let slabs = nstd_vec_len(&interner.slabs);
+        let mut slab = match slabs > 0 {
+            // SAFETY: The slab list is byte aligned, so the slab must be read unaligned.
+            true => nstd_vec_get(&interner.slabs, slabs - 1)
+                .cast::<Slab>()
+                .read_unaligned(),
+            false => Slab {
+                ptr: NSTD_NULL,
+                len: 0,
+                cap: 0,
+            },
+        };
+        if slab.cap - slab.len >= bytes.len {
+            // The bytes fit in the active slab.
+            let dest = slab.ptr.add(slab.len);
+            nstd_core_mem_copy(dest.cast(), bytes.ptr.raw.cast(), bytes.len);
+            slab.len += bytes.len;
+            ptr = dest as NSTDAnyConst;
+            nstd_vec_get_mut(&mut interner.slabs, slabs - 1)
+                .cast::<Slab>()
+                .write_unaligned(slab);
+        } else {
+            // Allocate a new slab for the bytes.
+            let cap = bytes.len.max(SLAB_SIZE);
+            let mem = nstd_alloc_allocate(cap);
+            if mem.is_null() {
+                *errc = 1;
+                return 0;
+            }
+            nstd_core_mem_copy(mem.cast(), bytes.ptr.raw.cast(), bytes.len);
+            let slab = Slab {
+                ptr: mem,
+                len: bytes.len,
+                cap,
+            };
+            let slab_ptr: *const Slab = &slab;
+            if nstd_vec_push(&mut interner.slabs, slab_ptr.cast()) != 0 {
+                let mut mem = mem;
+                nstd_alloc_deallocate(&mut mem, cap);
+                *errc = 1;
+                return 0;
+            }
+            ptr = mem as NSTDAnyConst;
+        }
+    }
+    // Create the string's view and id.
+    let slice = nstd_core_slice_const_new(ptr, 1, bytes.len);
+    let view = nstd_core_str_const_from_bytes_unchecked(&slice);
+    let view_ptr: *const NSTDStrConst = &view;
+    if nstd_vec_push(&mut interner.views, view_ptr.cast()) != 0 {
+        *errc = 1;
+        return 0;
+    }
+    // Insert the new id into the hash table.
+    let mut i = hash as usize & (interner.table_cap - 1);
+    // SAFETY: The table has more slots than interned strings, so probing always finds an empty
+    // slot.
+    while *interner.slot(i) != 0 {
+        i = (i + 1) & (interner.table_cap - 1);
+    }
+    *interner.slot(i) = len + 1;
+    len
+}
+
+/// Returns the stable string view with id `id`.
+///
+/// The view's data lives in the interner's slabs and remains valid for the interner's lifetime.
+///
+/// # Parameters:
+///
+/// - `const NSTDInterner *interner` - The string interner.
+///
+/// - `NSTDUSize id` - The id of the string to get.
+///
+/// # Returns
+///
+/// `NSTDStrConst str` - The interned string with id `id`, or an empty string slice if `id` is
+/// not a valid id.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_interner_get(interner: &NSTDInterner, id: NSTDUSize) -> NSTDStrConst {
+    match id < nstd_vec_len(&interner.views) {
+        // SAFETY: `id` is within the view list's boundaries.
+        true => unsafe { interner.view(id) },
+        false => {
+            let slice = nstd_core_slice_const_new(NSTD_NULL, 1, 0);
+            // SAFETY: The empty slice is trivially valid UTF-8.
+            unsafe { nstd_core_str_const_from_bytes_unchecked(&slice) }
+        }
+    }
+}
+
+/// Frees an instance of `NSTDInterner`, invalidating all of it's string views.
+///
+/// # Parameters:
+///
+/// - `NSTDInterner interner` - The string interner to free.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+#[allow(unused_variables)]
+pub extern "C" fn nstd_interner_free(interner: NSTDInterner) {}
@@ -13,12 +13,21 @@ pub mod core;
 #[cfg(feature = "nstd_cstring")]
 #[cfg_attr(doc_cfg, doc(cfg(feature = "nstd_cstring")))]
 pub mod cstring;
+#[cfg(feature = "nstd_hash_map")]
+#[cfg_attr(doc_cfg, doc(cfg(feature = "nstd_hash_map")))]
+pub mod hash_map;
 #[cfg(feature = "nstd_heap_ptr")]
 #[cfg_attr(doc_cfg, doc(cfg(feature = "nstd_heap_ptr")))]
 pub mod heap_ptr;
+#[cfg(feature = "nstd_interner")]
+#[cfg_attr(doc_cfg, doc(cfg(feature = "nstd_interner")))]
+pub mod interner;
 #[cfg(feature = "nstd_os")]
 #[cfg_attr(doc_cfg, doc(cfg(feature = "nstd_os")))]
 pub mod os;
+#[cfg(feature = "nstd_queue")]
+#[cfg_attr(doc_cfg, doc(cfg(feature = "nstd_queue")))]
+pub mod queue;
 #[cfg(feature = "nstd_shared_ptr")]
 #[cfg_attr(doc_cfg, doc(cfg(feature = "nstd_shared_ptr")))]
 pub mod shared_ptr;
@@ -1,3 +1,5 @@
 //! Operating system specific functionality.
+#[cfg(target_family = "unix")]
+pub mod unix;
 #[cfg(target_os = "windows")]
 pub mod windows;
@@ -0,0 +1,4 @@
+//! OS support for Unix like systems.
+#[cfg(feature = "nstd_os_unix_mmap")]
+#[cfg_attr(doc_cfg, doc(cfg(feature = "nstd_os_unix_mmap")))]
+pub mod mmap;
@@ -0,0 +1,123 @@
+//! Read-only memory mapped file views for Unix like systems.
+use crate::{
+    core::{
+        def::{NSTDChar, NSTDErrorCode},
+        slice::{nstd_core_slice_const_new, NSTDSliceConst},
+    },
+    NSTDUSize, NSTD_NULL,
+};
+use libc::{
+    close, fstat, madvise, mmap, munmap, open, stat, MADV_DONTNEED, MADV_NORMAL, MADV_RANDOM,
+    MADV_SEQUENTIAL, MADV_WILLNEED, MAP_FAILED, MAP_PRIVATE, O_RDONLY, PROT_READ,
+};
+
+/// Describes how a memory mapped file view is expected to be accessed.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Hash, PartialEq, Eq)]
+pub enum NSTDUnixMmapAdvice {
+    /// No special access pattern, the operating system's default behavior.
+    Normal,
+    /// The view will be read from start to finish, read-ahead may be increased.
+    Sequential,
+    /// The view will be accessed in a random order, read-ahead may be useless.
+    Random,
+    /// The view will be needed soon, pages may be read ahead of time.
+    WillNeed,
+    /// The view will not be needed soon, pages may be released.
+    DontNeed,
+}
+
+/// Creates a read-only memory mapped view over the contents of the file at `path`.
+///
+/// The view is backed directly by the operating system's page cache, no copy of the file's
+/// contents is made. The view must be unmapped with `nstd_os_unix_mmap_unmap` once it is no longer
+/// in use.
+///
+/// # Parameters:
+///
+/// - `const NSTDChar *path` - A path to the file to map.
+///
+/// # Returns
+///
+/// `NSTDSliceConst view` - A byte slice view over the file's contents. The view will be empty if
+/// the file is empty or mapping fails.
+///
+/// # Safety
+///
+/// - `path` must point to a null terminated C string.
+///
+/// - The view is invalidated if the file is truncated while it is mapped.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_os_unix_mmap_map(path: *const NSTDChar) -> NSTDSliceConst {
+    let empty = nstd_core_slice_const_new(NSTD_NULL, 1, 0);
+    let fd = open(path.cast(), O_RDONLY);
+    if fd < 0 {
+        return empty;
+    }
+    let mut status = core::mem::zeroed::<stat>();
+    if fstat(fd, &mut status) != 0 || status.st_size <= 0 {
+        close(fd);
+        return empty;
+    }
+    let size = status.st_size as NSTDUSize;
+    let view = mmap(core::ptr::null_mut(), size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if view == MAP_FAILED {
+        return empty;
+    }
+    nstd_core_slice_const_new(view.cast(), 1, size)
+}
+
+/// Advises the operating system on how a memory mapped file view is expected to be accessed.
+///
+/// This is purely a performance hint, a view behaves identically with or without it.
+///
+/// # Parameters:
+///
+/// - `const NSTDSliceConst *view` - The memory mapped file view.
+///
+/// - `NSTDUnixMmapAdvice advice` - The expected access pattern.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero if the operating system rejected the hint.
+///
+/// # Safety
+///
+/// `view` must be a view returned by `nstd_os_unix_mmap_map` that has not yet been unmapped.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_os_unix_mmap_advise(
+    view: &NSTDSliceConst,
+    advice: NSTDUnixMmapAdvice,
+) -> NSTDErrorCode {
+    let advice = match advice {
+        NSTDUnixMmapAdvice::Normal => MADV_NORMAL,
+        NSTDUnixMmapAdvice::Sequential => MADV_SEQUENTIAL,
+        NSTDUnixMmapAdvice::Random => MADV_RANDOM,
+        NSTDUnixMmapAdvice::WillNeed => MADV_WILLNEED,
+        NSTDUnixMmapAdvice::DontNeed => MADV_DONTNEED,
+    };
+    (madvise(view.ptr.raw as *mut _, view.byte_len(), advice) != 0) as NSTDErrorCode
+}
+
+/// Unmaps a memory mapped file view.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceConst view` - The memory mapped file view to unmap.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// `view` must be a view returned by `nstd_os_unix_mmap_map`. The view's data must not be accessed
+/// after this function is called.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_os_unix_mmap_unmap(view: NSTDSliceConst) -> NSTDErrorCode {
+    if view.ptr.raw.is_null() {
+        return 0;
+    }
+    (munmap(view.ptr.raw as *mut _, view.byte_len()) != 0) as NSTDErrorCode
+}
@@ -1,10 +1,141 @@
 //! Low level memory allocation for Windows.
-use crate::{core::def::NSTDErrorCode, NSTDAnyMut, NSTDUSize, NSTD_NULL};
-use windows_sys::Win32::System::Memory::{
-    GetProcessHeap, HeapAlloc, HeapFree, HeapReAlloc, HEAP_FLAGS, HEAP_ZERO_MEMORY,
+use crate::{core::def::NSTDErrorCode, NSTDAnyMut, NSTDBool, NSTDISize, NSTDUSize, NSTD_NULL};
+use core::sync::atomic::{AtomicU32, Ordering};
+use windows_sys::Win32::System::{
+    Memory::{
+        GetProcessHeap, HeapAlloc, HeapCreate, HeapDestroy, HeapFree, HeapReAlloc, HEAP_FLAGS,
+        HEAP_NO_SERIALIZE, HEAP_ZERO_MEMORY,
+    },
+    Threading::{TlsAlloc, TlsFree, TlsGetValue, TlsSetValue},
 };
 
-/// Allocates a new block of memory on the current process' heap.
+/// A handle to a Windows heap.
+pub type NSTDWindowsHeapHandle = NSTDISize;
+
+/// The value that `TlsAlloc` returns on failure.
+const TLS_OUT_OF_INDEXES: u32 = u32::MAX;
+
+/// The TLS index that stores each thread's heap override.
+///
+/// Remains `TLS_OUT_OF_INDEXES` until the first call to `nstd_os_windows_alloc_set_heap`.
+static HEAP_TLS_INDEX: AtomicU32 = AtomicU32::new(TLS_OUT_OF_INDEXES);
+
+/// Returns the heap that the calling thread's allocations are routed to.
+///
+/// This is the last heap passed to `nstd_os_windows_alloc_set_heap` on the calling thread, or the
+/// process default heap if no override is set.
+unsafe fn this_thread_heap() -> NSTDWindowsHeapHandle {
+    let index = HEAP_TLS_INDEX.load(Ordering::Acquire);
+    if index != TLS_OUT_OF_INDEXES {
+        let heap = TlsGetValue(index) as NSTDWindowsHeapHandle;
+        if heap != 0 {
+            return heap;
+        }
+    }
+    GetProcessHeap()
+}
+
+/// Creates a new private heap.
+///
+/// The heap grows as needed. When `no_serialize` is true the heap's operations are not serialized
+/// by a lock, in this case the heap must only be used from one thread at a time.
+///
+/// # Parameters:
+///
+/// - `NSTDBool no_serialize` - `NSTD_TRUE` to skip lock serialization for thread-confined heaps.
+///
+/// # Returns
+///
+/// `NSTDWindowsHeapHandle heap` - A handle to the new heap, 0 on error.
+///
+/// # Safety
+///
+/// See <https://docs.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapcreate>.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_os_windows_alloc_heap_new(
+    no_serialize: NSTDBool,
+) -> NSTDWindowsHeapHandle {
+    let flags = match no_serialize != 0 {
+        true => HEAP_NO_SERIALIZE,
+        false => HEAP_FLAGS::default(),
+    };
+    HeapCreate(flags, 0, 0)
+}
+
+/// Destroys a private heap, invalidating every block allocated from it.
+///
+/// # Parameters:
+///
+/// - `NSTDWindowsHeapHandle *heap` - The heap to destroy.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// See <https://docs.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapdestroy>.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_os_windows_alloc_heap_free(
+    heap: &mut NSTDWindowsHeapHandle,
+) -> NSTDErrorCode {
+    let handle = *heap;
+    *heap = 0;
+    (HeapDestroy(handle) == 0) as NSTDErrorCode
+}
+
+/// Routes the calling thread's allocations through `heap`.
+///
+/// Until the next call to this function on the same thread, the `nstd_os_windows_alloc_*`
+/// functions (and everything built on them, such as `NSTDVec` growth) use `heap` instead of the
+/// process default heap. Pass 0 to restore the process default heap.
+///
+/// # Parameters:
+///
+/// - `NSTDWindowsHeapHandle heap` - The heap to route the calling thread's allocations through.
+///
+/// # Returns
+///
+/// `NSTDWindowsHeapHandle prev` - The previous override, 0 if none was set.
+///
+/// # Panics
+///
+/// This function will panic if the operating system runs out of TLS indexes.
+///
+/// # Safety
+///
+/// Memory must be deallocated through the same heap it was allocated from, the caller is
+/// responsible for restoring the previous heap before freeing memory that was allocated under it.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_os_windows_alloc_set_heap(
+    heap: NSTDWindowsHeapHandle,
+) -> NSTDWindowsHeapHandle {
+    let mut index = HEAP_TLS_INDEX.load(Ordering::Acquire);
+    if index == TLS_OUT_OF_INDEXES {
+        let new_index = TlsAlloc();
+        assert!(new_index != TLS_OUT_OF_INDEXES);
+        match HEAP_TLS_INDEX.compare_exchange(
+            TLS_OUT_OF_INDEXES,
+            new_index,
+            Ordering::AcqRel,
+            Ordering::Acquire,
+        ) {
+            Ok(_) => index = new_index,
+            // Another thread allocated the index first, release ours and use it's.
+            Err(current) => {
+                TlsFree(new_index);
+                index = current;
+            }
+        }
+    }
+    let prev = TlsGetValue(index) as NSTDWindowsHeapHandle;
+    TlsSetValue(index, heap as _);
+    prev
+}
+
+/// Allocates a new block of memory on the calling thread's heap.
 ///
 /// # Parameters:
 ///
@@ -20,10 +151,10 @@ use windows_sys::Win32::System::Memory::{
 #[inline]
 #[cfg_attr(feature = "clib", no_mangle)]
 pub unsafe extern "C" fn nstd_os_windows_alloc_allocate(size: NSTDUSize) -> NSTDAnyMut {
-    HeapAlloc(GetProcessHeap(), HEAP_FLAGS::default(), size)
+    HeapAlloc(this_thread_heap(), HEAP_FLAGS::default(), size)
 }
 
-/// Allocates a new block of zero-initialized memory on the current process' heap.
+/// Allocates a new block of zero-initialized memory on the calling thread's heap.
 ///
 /// # Parameters:
 ///
@@ -39,7 +170,7 @@ pub unsafe extern "C" fn nstd_os_windows_alloc_allocate(size: NSTDUSize) -> NSTD
 #[inline]
 #[cfg_attr(feature = "clib", no_mangle)]
 pub unsafe extern "C" fn nstd_os_windows_alloc_allocate_zeroed(size: NSTDUSize) -> NSTDAnyMut {
-    HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, size)
+    HeapAlloc(this_thread_heap(), HEAP_ZERO_MEMORY, size)
 }
 
 /// Reallocates a block of memory previously allocated by
@@ -68,7 +199,7 @@ pub unsafe extern "C" fn nstd_os_windows_alloc_reallocate(
     ptr: &mut NSTDAnyMut,
     new_size: NSTDUSize,
 ) -> NSTDErrorCode {
-    let new_mem = HeapReAlloc(GetProcessHeap(), HEAP_FLAGS::default(), *ptr, new_size);
+    let new_mem = HeapReAlloc(this_thread_heap(), HEAP_FLAGS::default(), *ptr, new_size);
     if !new_mem.is_null() {
         *ptr = new_mem;
         return 0;
@@ -95,5 +226,115 @@ pub unsafe extern "C" fn nstd_os_windows_alloc_reallocate(
 pub unsafe extern "C" fn nstd_os_windows_alloc_deallocate(ptr: &mut NSTDAnyMut) -> NSTDErrorCode {
     let memptr = *ptr;
     *ptr = NSTD_NULL;
-    (HeapFree(GetProcessHeap(), HEAP_FLAGS::default(), memptr) == 0) as NSTDErrorCode
+    (HeapFree(this_thread_heap(), HEAP_FLAGS::default(), memptr) == 0) as NSTDErrorCode
+}
+
+/// Allocates a new block of memory on `heap`.
+///
+/// # Parameters:
+///
+/// - `NSTDWindowsHeapHandle heap` - The heap to allocate from.
+///
+/// - `NSTDUSize size` - The number of bytes to allocate.
+///
+/// # Returns
+///
+/// `NSTDAnyMut ptr` - A pointer to the block of memory, null on error.
+///
+/// # Safety
+///
+/// See <https://docs.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapalloc>.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_os_windows_alloc_heap_allocate(
+    heap: NSTDWindowsHeapHandle,
+    size: NSTDUSize,
+) -> NSTDAnyMut {
+    HeapAlloc(heap, HEAP_FLAGS::default(), size)
+}
+
+/// Allocates a new block of zero-initialized memory on `heap`.
+///
+/// # Parameters:
+///
+/// - `NSTDWindowsHeapHandle heap` - The heap to allocate from.
+///
+/// - `NSTDUSize size` - The number of bytes to allocate.
+///
+/// # Returns
+///
+/// `NSTDAnyMut ptr` - A pointer to the block of memory, null on error.
+///
+/// # Safety
+///
+/// See <https://docs.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapalloc>.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_os_windows_alloc_heap_allocate_zeroed(
+    heap: NSTDWindowsHeapHandle,
+    size: NSTDUSize,
+) -> NSTDAnyMut {
+    HeapAlloc(heap, HEAP_ZERO_MEMORY, size)
+}
+
+/// Reallocates a block of memory previously allocated on `heap`.
+///
+/// If everything goes right, the pointer will point to the new memory location and 0 will be
+/// returned. If this is not the case and allocation fails, the pointer will remain untouched and a
+/// value of nonzero is returned.
+///
+/// # Parameters:
+///
+/// - `NSTDWindowsHeapHandle heap` - The heap the memory was allocated from.
+///
+/// - `NSTDAnyMut *ptr` - A pointer to the allocated memory.
+///
+/// - `NSTDUSize new_size` - The number of bytes to reallocate.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// See <https://docs.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heaprealloc>.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_os_windows_alloc_heap_reallocate(
+    heap: NSTDWindowsHeapHandle,
+    ptr: &mut NSTDAnyMut,
+    new_size: NSTDUSize,
+) -> NSTDErrorCode {
+    let new_mem = HeapReAlloc(heap, HEAP_FLAGS::default(), *ptr, new_size);
+    if !new_mem.is_null() {
+        *ptr = new_mem;
+        return 0;
+    }
+    1
+}
+
+/// Deallocates a block of memory previously allocated on `heap`.
+///
+/// # Parameters:
+///
+/// - `NSTDWindowsHeapHandle heap` - The heap the memory was allocated from.
+///
+/// - `NSTDAnyMut *ptr` - A pointer to the allocated memory.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// See <https://docs.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapfree>.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_os_windows_alloc_heap_deallocate(
+    heap: NSTDWindowsHeapHandle,
+    ptr: &mut NSTDAnyMut,
+) -> NSTDErrorCode {
+    let memptr = *ptr;
+    *ptr = NSTD_NULL;
+    (HeapFree(heap, HEAP_FLAGS::default(), memptr) == 0) as NSTDErrorCode
 }
@@ -0,0 +1,100 @@
+//! Read-only memory mapped file views for Windows.
+use crate::{
+    core::{
+        def::{NSTDChar, NSTDErrorCode},
+        slice::{nstd_core_slice_const_new, NSTDSliceConst},
+    },
+    NSTDUSize, NSTD_NULL,
+};
+use windows_sys::Win32::{
+    Foundation::{CloseHandle, INVALID_HANDLE_VALUE},
+    Storage::FileSystem::{
+        CreateFileA, GetFileSizeEx, FILE_ATTRIBUTE_NORMAL, FILE_SHARE_READ, OPEN_EXISTING,
+    },
+    System::{
+        Memory::{
+            CreateFileMappingA, MapViewOfFile, UnmapViewOfFile, FILE_MAP_READ, PAGE_READONLY,
+        },
+        SystemServices::GENERIC_READ,
+    },
+};
+
+/// Creates a read-only memory mapped view over the contents of the file at `path`.
+///
+/// The view is backed directly by the operating system's page cache, no copy of the file's
+/// contents is made. The view must be unmapped with `nstd_os_windows_mmap_unmap` once it is no
+/// longer in use.
+///
+/// # Parameters:
+///
+/// - `const NSTDChar *path` - A path to the file to map.
+///
+/// # Returns
+///
+/// `NSTDSliceConst view` - A byte slice view over the file's contents. The view will be empty if
+/// the file is empty or mapping fails.
+///
+/// # Safety
+///
+/// See <https://docs.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-mapviewoffile>.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_os_windows_mmap_map(path: *const NSTDChar) -> NSTDSliceConst {
+    let empty = nstd_core_slice_const_new(NSTD_NULL, 1, 0);
+    let file = CreateFileA(
+        path.cast(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        core::ptr::null(),
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        0,
+    );
+    if file == INVALID_HANDLE_VALUE {
+        return empty;
+    }
+    let mut size = 0i64;
+    if GetFileSizeEx(file, &mut size) == 0 || size <= 0 {
+        CloseHandle(file);
+        return empty;
+    }
+    let mapping = CreateFileMappingA(
+        file,
+        core::ptr::null(),
+        PAGE_READONLY,
+        0,
+        0,
+        core::ptr::null(),
+    );
+    CloseHandle(file);
+    if mapping == 0 {
+        return empty;
+    }
+    // The mapping object is kept alive by the mapped view, so it's handle can be closed here.
+    let view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if view.is_null() {
+        return empty;
+    }
+    nstd_core_slice_const_new(view, 1, size as NSTDUSize)
+}
+
+/// Unmaps a memory mapped file view.
+///
+/// # Parameters:
+///
+/// - `NSTDSliceConst view` - The memory mapped file view to unmap.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// See <https://docs.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-unmapviewoffile>.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_os_windows_mmap_unmap(view: NSTDSliceConst) -> NSTDErrorCode {
+    if view.ptr.raw.is_null() {
+        return 0;
+    }
+    (UnmapViewOfFile(view.ptr.raw) == 0) as NSTDErrorCode
+}
@@ -0,0 +1,300 @@
+//! A bounded lock-free multi-producer multi-consumer queue.
+//!
+//! The queue is a fixed capacity ring buffer of untyped fixed size elements, like
+//! [NSTDVec][crate::vec::NSTDVec]. Each slot carries it's own sequence number (Dmitry Vyukov's
+//! bounded MPMC queue algorithm) so that producers and consumers coordinate through a single
+//! atomic compare-and-swap per operation, without ever taking a lock. Slots are padded out to
+//! cache line boundaries to prevent false sharing between threads operating on neighboring slots.
+use crate::{
+    alloc::{nstd_alloc_allocate_aligned, nstd_alloc_deallocate_aligned},
+    core::{
+        def::{NSTDByte, NSTDErrorCode},
+        mem::nstd_core_mem_copy,
+    },
+    NSTDAnyConst, NSTDAnyMut, NSTDUSize,
+};
+use core::sync::atomic::{AtomicUsize, Ordering};
+
+/// The size (in bytes) of a cache line.
+const CACHE_LINE: usize = 64;
+
+/// The size (in bytes) of [usize].
+const USIZE_SIZE: usize = core::mem::size_of::<usize>();
+
+/// A bounded lock-free multi-producer multi-consumer queue.
+#[repr(C)]
+#[derive(Debug)]
+pub struct NSTDQueue {
+    /// A pointer to the ring buffer's slots.
+    ///
+    /// Each slot stores it's sequence number followed by the element's bytes and is padded out to
+    /// a cache line multiple.
+    buffer: NSTDAnyMut,
+    /// The number of slots in the ring buffer, always a power of two.
+    cap: NSTDUSize,
+    /// The size in bytes of each element in the queue.
+    element_size: NSTDUSize,
+    /// The size in bytes of each slot in the ring buffer.
+    stride: NSTDUSize,
+    /// Padding to keep the enqueue position on it's own cache line.
+    pad0: [NSTDByte; CACHE_LINE - USIZE_SIZE],
+    /// The position the next element will be pushed at.
+    push_pos: AtomicUsize,
+    /// Padding to keep the dequeue position on it's own cache line.
+    pad1: [NSTDByte; CACHE_LINE - USIZE_SIZE],
+    /// The position the next element will be popped from.
+    pop_pos: AtomicUsize,
+}
+impl NSTDQueue {
+    /// Returns a reference to the sequence number of the slot at `index`.
+    ///
+    /// # Safety
+    ///
+    /// The queue's buffer must be non-null and `index` must be less than `self.cap`.
+    #[inline]
+    unsafe fn sequence(&self, index: usize) -> &AtomicUsize {
+        &*self.buffer.add(index * self.stride).cast()
+    }
+
+    /// Returns a pointer to the element bytes of the slot at `index`.
+    ///
+    /// # Safety
+    ///
+    /// The queue's buffer must be non-null and `index` must be less than `self.cap`.
+    #[inline]
+    unsafe fn element(&self, index: usize) -> NSTDAnyMut {
+        self.buffer.add(index * self.stride + USIZE_SIZE)
+    }
+}
+// SAFETY: The queue's operations synchronize access to the buffer through the slot sequence
+// numbers.
+unsafe impl Send for NSTDQueue {}
+// SAFETY: Same as above.
+unsafe impl Sync for NSTDQueue {}
+impl Drop for NSTDQueue {
+    /// [NSTDQueue]'s destructor.
+    #[inline]
+    fn drop(&mut self) {
+        if !self.buffer.is_null() {
+            let buffer_size = self.cap * self.stride;
+            // SAFETY: The buffer was allocated with `CACHE_LINE` alignment.
+            unsafe { nstd_alloc_deallocate_aligned(&mut self.buffer, buffer_size, CACHE_LINE) };
+        }
+    }
+}
+
+/// Creates a new queue with room for at least `cap` elements.
+///
+/// The capacity is rounded up to the next power of two.
+///
+/// # Note
+///
+/// This will return a "null queue" (a queue with no buffer) on error.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize element_size` - The size in bytes of each element in the queue.
+///
+/// - `NSTDUSize cap` - The minimum number of elements the queue can hold.
+///
+/// # Returns
+///
+/// `NSTDQueue queue` - The new queue.
+///
+/// # Panics
+///
+/// This function will panic if either `element_size` or `cap` are zero.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_queue_new(element_size: NSTDUSize, cap: NSTDUSize) -> NSTDQueue {
+    // Ensure that neither `element_size` or `cap` are zero.
+    assert!(element_size != 0);
+    assert!(cap != 0);
+    let cap = cap.next_power_of_two();
+    // Pad each slot out to a cache line multiple.
+    let slot_size = USIZE_SIZE + element_size;
+    let stride = (slot_size + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+    // Attempt to allocate the ring buffer.
+    // SAFETY: The allocation size is non-zero and `CACHE_LINE` is a power of two.
+    let buffer = unsafe { nstd_alloc_allocate_aligned(cap * stride, CACHE_LINE) };
+    let queue = NSTDQueue {
+        buffer,
+        cap: match buffer.is_null() {
+            true => 0,
+            false => cap,
+        },
+        element_size,
+        stride,
+        pad0: [0; CACHE_LINE - USIZE_SIZE],
+        push_pos: AtomicUsize::new(0),
+        pad1: [0; CACHE_LINE - USIZE_SIZE],
+        pop_pos: AtomicUsize::new(0),
+    };
+    // Initialize each slot's sequence number to it's index.
+    if !buffer.is_null() {
+        for i in 0..cap {
+            // SAFETY: `i` is within the buffer's boundaries.
+            unsafe { queue.sequence(i).store(i, Ordering::Relaxed) };
+        }
+    }
+    queue
+}
+
+/// Returns the number of elements a queue can hold.
+///
+/// # Parameters:
+///
+/// - `const NSTDQueue *queue` - The queue.
+///
+/// # Returns
+///
+/// `NSTDUSize cap` - The queue's capacity.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_queue_cap(queue: &NSTDQueue) -> NSTDUSize {
+    queue.cap
+}
+
+/// Attempts to push a value onto the end of a queue without blocking.
+///
+/// This operation is safe to call from any number of threads at once and never takes a lock.
+///
+/// # Parameters:
+///
+/// - `const NSTDQueue *queue` - The queue.
+///
+/// - `NSTDAnyConst value` - A pointer to the value to push onto the queue.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero if the queue is full.
+///
+/// # Safety
+///
+/// This operation is unsafe because undefined behaviour can occur if the size of the value being
+/// pushed onto the queue is not equal to the queue's element size.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_queue_try_push(
+    queue: &NSTDQueue,
+    value: NSTDAnyConst,
+) -> NSTDErrorCode {
+    if queue.buffer.is_null() {
+        return 1;
+    }
+    let mask = queue.cap - 1;
+    let mut pos = queue.push_pos.load(Ordering::Relaxed);
+    loop {
+        let index = pos & mask;
+        let sequence = queue.sequence(index).load(Ordering::Acquire);
+        // The slot is free when it's sequence number matches the push position. The difference is
+        // computed with wrapping arithmetic so that the positions may safely wrap around.
+        let diff = sequence.wrapping_sub(pos) as isize;
+        if diff == 0 {
+            match queue.push_pos.compare_exchange_weak(
+                pos,
+                pos.wrapping_add(1),
+                Ordering::Relaxed,
+                Ordering::Relaxed,
+            ) {
+                Ok(_) => {
+                    // The slot is now owned by this thread, fill it and publish it to consumers.
+                    nstd_core_mem_copy(
+                        queue.element(index).cast(),
+                        value.cast(),
+                        queue.element_size,
+                    );
+                    queue
+                        .sequence(index)
+                        .store(pos.wrapping_add(1), Ordering::Release);
+                    return 0;
+                }
+                // Another producer claimed the slot first.
+                Err(current) => pos = current,
+            }
+        }
+        // The slot still holds an unconsumed element from the previous lap, the queue is full.
+        else if diff < 0 {
+            return 1;
+        }
+        // Another producer claimed the slot first.
+        else {
+            pos = queue.push_pos.load(Ordering::Relaxed);
+        }
+    }
+}
+
+/// Attempts to pop a value off of the front of a queue without blocking.
+///
+/// This operation is safe to call from any number of threads at once and never takes a lock.
+///
+/// # Parameters:
+///
+/// - `const NSTDQueue *queue` - The queue.
+///
+/// - `NSTDAnyMut value` - A pointer to the memory to receive the popped value.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero if the queue is empty.
+///
+/// # Safety
+///
+/// This operation is unsafe because undefined behaviour can occur if `value`'s size is not equal
+/// to the queue's element size.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_queue_try_pop(queue: &NSTDQueue, value: NSTDAnyMut) -> NSTDErrorCode {
+    if queue.buffer.is_null() {
+        return 1;
+    }
+    let mask = queue.cap - 1;
+    let mut pos = queue.pop_pos.load(Ordering::Relaxed);
+    loop {
+        let index = pos & mask;
+        let sequence = queue.sequence(index).load(Ordering::Acquire);
+        // The slot holds an element when it's sequence number is one past the pop position. The
+        // difference is computed with wrapping arithmetic so that the positions may safely wrap
+        // around.
+        let diff = sequence.wrapping_sub(pos.wrapping_add(1)) as isize;
+        if diff == 0 {
+            match queue.pop_pos.compare_exchange_weak(
+                pos,
+                pos.wrapping_add(1),
+                Ordering::Relaxed,
+                Ordering::Relaxed,
+            ) {
+                Ok(_) => {
+                    // The slot is now owned by this thread, empty it and release it to producers
+                    // for the next lap around the ring.
+                    nstd_core_mem_copy(
+                        value.cast(),
+                        queue.element(index).cast(),
+                        queue.element_size,
+                    );
+                    queue
+                        .sequence(index)
+                        .store(pos.wrapping_add(mask + 1), Ordering::Release);
+                    return 0;
+                }
+                // Another consumer claimed the slot first.
+                Err(current) => pos = current,
+            }
+        }
+        // The slot has not been filled yet, the queue is empty.
+        else if diff < 0 {
+            return 1;
+        }
+        // Another consumer claimed the slot first.
+        else {
+            pos = queue.pop_pos.load(Ordering::Relaxed);
+        }
+    }
+}
+
+/// Frees an instance of `NSTDQueue`.
+///
+/// # Parameters:
+///
+/// - `NSTDQueue queue` - The queue to free.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+#[allow(unused_variables)]
+pub extern "C" fn nstd_queue_free(queue: NSTDQueue) {}
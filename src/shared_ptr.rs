@@ -7,10 +7,20 @@ use crate::{
     },
     NSTDAnyConst, NSTDUSize,
 };
+use core::sync::atomic::{fence, AtomicUsize, Ordering};
 
 /// The size (in bytes) of [usize].
 const USIZE_SIZE: usize = core::mem::size_of::<usize>();
 
+/// The alignment (in bytes) of [usize].
+const USIZE_ALIGN: usize = core::mem::align_of::<usize>();
+
+/// Rounds `size` up to the next multiple of [usize]'s alignment.
+#[inline]
+fn align_up(size: usize) -> usize {
+    (size + USIZE_ALIGN - 1) & !(USIZE_ALIGN - 1)
+}
+
 /// A reference counting smart pointer.
 #[repr(C)]
 #[derive(Debug, Hash, PartialEq, Eq)]
@@ -188,3 +198,198 @@ pub extern "C" fn nstd_shared_ptr_get(shared_ptr: &NSTDSharedPtr) -> NSTDAnyCons
 #[cfg_attr(feature = "clib", no_mangle)]
 #[allow(unused_variables)]
 pub extern "C" fn nstd_shared_ptr_free(shared_ptr: NSTDSharedPtr) {}
+
+/// An atomically reference counting smart pointer.
+///
+/// Unlike [NSTDSharedPtr], instances of this type may be shared across and freed from different
+/// threads, making it suitable for sharing immutable data across a thread pool with a single
+/// allocation.
+#[repr(C)]
+#[derive(Debug, Hash, PartialEq, Eq)]
+pub struct NSTDSharedPtrAtomic {
+    /// A pointer to private data about the shared object.
+    ptr: NSTDPtrMut,
+}
+impl NSTDSharedPtrAtomic {
+    /// Returns a reference to the atomic pointer count.
+    ///
+    /// The count is always stored at an offset aligned for a [usize], atomic operations require
+    /// aligned memory.
+    #[inline]
+    fn ptrs(&self) -> &AtomicUsize {
+        unsafe { &*self.ptr.raw.add(self.ptr.size - USIZE_SIZE).cast() }
+    }
+}
+impl Drop for NSTDSharedPtrAtomic {
+    /// [NSTDSharedPtrAtomic]'s destructor.
+    fn drop(&mut self) {
+        // Update the pointer count. If the pointer count was one, this was the last owner, so
+        // free the data. The release/acquire pairing ensures that every other owner's use of the
+        // shared object happens before it is freed.
+        if self.ptrs().fetch_sub(1, Ordering::Release) == 1 {
+            fence(Ordering::Acquire);
+            // SAFETY: The shared object's buffer is non-null.
+            unsafe { nstd_alloc_deallocate(&mut self.ptr.raw, self.ptr.size) };
+        }
+    }
+}
+
+/// Creates a new initialized instance of an atomically reference counted shared pointer.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize element_size` - The size of the shared object.
+///
+/// - `NSTDAnyConst init` - A pointer to the object to initialize the shared pointer with.
+///
+/// # Returns
+///
+/// `NSTDSharedPtrAtomic shared_ptr` - The new shared pointer.
+///
+/// # Panics
+///
+/// This operation will panic if allocating fails.
+///
+/// # Safety
+///
+/// This operation is unsafe because passing `init` as a null pointer can cause undefined behavior.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_shared_ptr_atomic_new(
+    element_size: NSTDUSize,
+    init: NSTDAnyConst,
+) -> NSTDSharedPtrAtomic {
+    // Allocate a region of memory for the object and the pointer count, rounding the count's
+    // offset up to it's alignment so the atomic operations on it use aligned memory.
+    let aligned_size = align_up(element_size);
+    let buffer_size = aligned_size + USIZE_SIZE;
+    let raw = nstd_alloc_allocate(buffer_size);
+    assert!(!raw.is_null());
+    // Initialize the shared object.
+    nstd_core_mem_copy(raw.cast(), init.cast(), element_size);
+    // Set the pointer count to one.
+    let ptrs = raw.add(aligned_size).cast::<AtomicUsize>();
+    core::ptr::write(ptrs, AtomicUsize::new(1));
+    // Construct the new shared pointer instance.
+    NSTDSharedPtrAtomic {
+        ptr: nstd_core_ptr_mut_new(raw, buffer_size),
+    }
+}
+
+/// Creates a new zero-initialized instance of an atomically reference counted shared pointer.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize element_size` - The size of the shared object.
+///
+/// # Returns
+///
+/// `NSTDSharedPtrAtomic shared_ptr` - The yet to be shared pointer.
+///
+/// # Panics
+///
+/// This operation will panic if allocating fails.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_shared_ptr_atomic_new_zeroed(
+    element_size: NSTDUSize,
+) -> NSTDSharedPtrAtomic {
+    unsafe {
+        // Allocate a region of memory for the object and the pointer count, rounding the count's
+        // offset up to it's alignment so the atomic operations on it use aligned memory.
+        let aligned_size = align_up(element_size);
+        let buffer_size = aligned_size + USIZE_SIZE;
+        let raw = nstd_alloc_allocate_zeroed(buffer_size);
+        assert!(!raw.is_null());
+        // Set the pointer count to one.
+        let ptrs = raw.add(aligned_size).cast::<AtomicUsize>();
+        core::ptr::write(ptrs, AtomicUsize::new(1));
+        // Construct the new shared pointer instance.
+        NSTDSharedPtrAtomic {
+            ptr: nstd_core_ptr_mut_new(raw, buffer_size),
+        }
+    }
+}
+
+/// Shares `shared_ptr`.
+///
+/// The pointer count is updated atomically, so the new instance may be handed off to another
+/// thread.
+///
+/// # Parameters:
+///
+/// - `const NSTDSharedPtrAtomic *shared_ptr` - The shared object to share.
+///
+/// # Returns
+///
+/// `NSTDSharedPtrAtomic shared` - A new pointer pointing to the shared data.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_shared_ptr_atomic_share(
+    shared_ptr: &NSTDSharedPtrAtomic,
+) -> NSTDSharedPtrAtomic {
+    // Update the pointer count. Relaxed ordering is sufficient here, new owners can only be
+    // created from an existing owner.
+    shared_ptr.ptrs().fetch_add(1, Ordering::Relaxed);
+    // Construct the new shared pointer instance.
+    NSTDSharedPtrAtomic {
+        ptr: nstd_core_ptr_mut_new(shared_ptr.ptr.raw, shared_ptr.ptr.size),
+    }
+}
+
+/// Returns the number pointers that share `shared_ptr`'s data.
+///
+/// # Parameters:
+///
+/// - `const NSTDSharedPtrAtomic *shared_ptr` - An instance of a shared pointer.
+///
+/// # Returns
+///
+/// `NSTDUSize owners` - The number pointers that share `shared_ptr`'s data.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_shared_ptr_atomic_owners(shared_ptr: &NSTDSharedPtrAtomic) -> NSTDUSize {
+    shared_ptr.ptrs().load(Ordering::Relaxed)
+}
+
+/// Returns the size of the shared object.
+///
+/// # Note
+///
+/// The returned size is rounded up to the alignment of the pointer count, so it may be slightly
+/// greater than the size the shared pointer was created with.
+///
+/// # Parameters:
+///
+/// - `const NSTDSharedPtrAtomic *shared_ptr` - The shared pointer.
+///
+/// # Returns
+///
+/// `NSTDUSize size` - The size of the shared object.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_shared_ptr_atomic_size(shared_ptr: &NSTDSharedPtrAtomic) -> NSTDUSize {
+    shared_ptr.ptr.size - USIZE_SIZE
+}
+
+/// Returns an immutable raw pointer to the shared object.
+///
+/// # Parameters:
+///
+/// - `const NSTDSharedPtrAtomic *shared_ptr` - The shared pointer.
+///
+/// # Returns
+///
+/// `NSTDAnyConst ptr` - A raw pointer to the shared object.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_shared_ptr_atomic_get(shared_ptr: &NSTDSharedPtrAtomic) -> NSTDAnyConst {
+    shared_ptr.ptr.raw
+}
+
+/// Frees an instance of `NSTDSharedPtrAtomic`.
+///
+/// # Parameters:
+///
+/// - `NSTDSharedPtrAtomic shared_ptr` - The shared object to free.
+#[cfg_attr(feature = "clib", no_mangle)]
+#[allow(unused_variables)]
+pub extern "C" fn nstd_shared_ptr_atomic_free(shared_ptr: NSTDSharedPtrAtomic) {}
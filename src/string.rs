@@ -1,6 +1,9 @@
 //! Dynamically sized UTF-8 encoded byte string.
+pub mod builder;
+pub mod cow;
 use crate::{
     core::{
+        cstr::{nstd_core_cstr_const_as_bytes, NSTDCStrConst},
         def::NSTDErrorCode,
         slice::{nstd_core_slice_const_new, NSTDSliceConst},
         str::{
@@ -10,11 +13,150 @@ use crate::{
     },
     vec::{
         nstd_vec_as_slice, nstd_vec_as_slice_mut, nstd_vec_clone, nstd_vec_extend, nstd_vec_len,
-        nstd_vec_new, nstd_vec_new_with_cap, nstd_vec_truncate, NSTDVec,
+        nstd_vec_new, nstd_vec_new_with_cap, nstd_vec_reserve, nstd_vec_truncate, NSTDVec,
     },
-    NSTDUSize, NSTDUnichar,
+    NSTDFloat32, NSTDFloat64, NSTDISize, NSTDInt16, NSTDInt32, NSTDInt64, NSTDInt8, NSTDUInt16,
+    NSTDUInt32, NSTDUInt64, NSTDUInt8, NSTDUSize, NSTDUnichar,
 };
 
+/// A lookup table of every pair of base-10 digits.
+const DEC_DIGIT_PAIRS: &[u8; 200] = b"0001020304050607080910111213141516171819\
+2021222324252627282930313233343536373839\
+4041424344454647484950515253545556575859\
+6061626364656667686970717273747576777879\
+8081828384858687888990919293949596979899";
+
+/// Writes `v`'s base-10 digits directly onto the end of `vec` after a single reserve, prepending
+/// a minus sign if `sign` is `true`.
+fn push_digits(vec: &mut NSTDVec, mut v: u64, sign: bool) -> NSTDErrorCode {
+    // Count the number of digits in `v`.
+    let mut digits = 1;
+    let mut x = v;
+    while x >= 10 {
+        digits += 1;
+        x /= 10;
+    }
+    let len = digits + sign as usize;
+    // Make sure there is room for `len` more bytes.
+    let free = vec.cap() - nstd_vec_len(vec);
+    if free < len && nstd_vec_reserve(vec, len - free) != 0 {
+        return 1;
+    }
+    // SAFETY: The reserve above guarantees room for `len` more bytes.
+    unsafe {
+        let start = vec.end().cast::<u8>();
+        if sign {
+            *start = b'-';
+        }
+        // Write pairs of digits starting from the least significant end.
+        let mut end = start.add(len);
+        while v >= 100 {
+            let pair = (v % 100) as usize * 2;
+            v /= 100;
+            end = end.sub(2);
+            core::ptr::copy_nonoverlapping(DEC_DIGIT_PAIRS.as_ptr().add(pair), end, 2);
+        }
+        if v >= 10 {
+            end = end.sub(2);
+            core::ptr::copy_nonoverlapping(DEC_DIGIT_PAIRS.as_ptr().add(v as usize * 2), end, 2);
+        } else {
+            end = end.sub(1);
+            *end = b'0' + v as u8;
+        }
+        vec.set_len(nstd_vec_len(vec) + len);
+    }
+    0
+}
+
+/// Writes a signed integer's base-10 representation onto the end of `vec`.
+#[inline]
+fn push_signed(vec: &mut NSTDVec, v: i64) -> NSTDErrorCode {
+    push_digits(vec, v.unsigned_abs(), v < 0)
+}
+
+/// Writes an unsigned integer's base-10 representation onto the end of `vec`.
+#[inline]
+fn push_unsigned(vec: &mut NSTDVec, v: u64) -> NSTDErrorCode {
+    push_digits(vec, v, false)
+}
+
+/// Writes a floating point value's decimal representation onto the end of `vec`.
+fn push_float<F: core::fmt::Display>(vec: &mut NSTDVec, v: F) -> NSTDErrorCode {
+    use core::fmt::Write;
+    /// A fixed size stack buffer for a formatted floating point value.
+    struct Buffer {
+        /// The formatted bytes.
+        bytes: [u8; 344],
+        /// The number of formatted bytes.
+        len: usize,
+    }
+    impl Default for Buffer {
+        /// Creates an empty buffer.
+        #[inline]
+        fn default() -> Self {
+            Self {
+                bytes: [0; 344],
+                len: 0,
+            }
+        }
+    }
+    impl Write for Buffer {
+        /// Appends `str`'s bytes to the buffer.
+        fn write_str(&mut self, str: &str) -> core::fmt::Result {
+            let bytes = str.as_bytes();
+            let free = self.bytes.len() - self.len;
+            if bytes.len() > free {
+                return Err(core::fmt::Error);
+            }
+            self.bytes[self.len..self.len + bytes.len()].copy_from_slice(bytes);
+            self.len += bytes.len();
+            Ok(())
+        }
+    }
+    let mut buf = Buffer::default();
+    // The buffer is large enough for any `NSTDFloat32`/`NSTDFloat64` value, including the
+    // subnormals, which span over 300 digits in positional notation.
+    if write!(buf, "{v}").is_err() {
+        return 1;
+    }
+    let bytes = nstd_core_slice_const_new(buf.bytes.as_ptr().cast(), 1, buf.len);
+    // SAFETY: The slice's data is valid for the duration of the call.
+    unsafe { nstd_vec_extend(vec, &bytes) }
+}
+
+/// Writes a 32-bit floating point value's decimal representation onto the end of `vec`.
+#[inline]
+fn push_f32(vec: &mut NSTDVec, v: f32) -> NSTDErrorCode {
+    push_float(vec, v)
+}
+
+/// Writes a 64-bit floating point value's decimal representation onto the end of `vec`.
+#[inline]
+fn push_f64(vec: &mut NSTDVec, v: f64) -> NSTDErrorCode {
+    push_float(vec, v)
+}
+
+/// Generates the `nstd_string_from_[i|u|f]*` functions.
+macro_rules! gen_from_primitive {
+    (
+        $(#[$meta:meta])*
+        $name: ident, $FromT: ty, $push: ident
+    ) => {
+        $(#[$meta])*
+        ///
+        /// # Note
+        ///
+        /// It is possible for this function to return an empty string if allocating fails.
+        #[inline]
+        #[cfg_attr(feature = "clib", no_mangle)]
+        pub extern "C" fn $name(v: $FromT) -> NSTDString {
+            let mut string = nstd_string_new();
+            $push(&mut string.bytes, v as _);
+            string
+        }
+    };
+}
+
 /// Dynamically sized UTF-8 encoded byte string.
 #[repr(C)]
 #[derive(Debug, Hash)]
@@ -203,6 +345,269 @@ pub unsafe extern "C" fn nstd_string_push_str(
     nstd_vec_extend(&mut string.bytes, &str_bytes)
 }
 
+/// Appends a UTF-8 encoded C string slice to the end of a string.
+///
+/// # Parameters:
+///
+/// - `NSTDString *string` - The string.
+///
+/// - `const NSTDCStrConst *cstr` - The C string slice to append to the end of `string`.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Possible errors
+///
+/// - `1` - `cstr`'s data is not valid UTF-8.
+///
+/// - `2` - Reserving memory for the push fails.
+///
+/// # Safety
+///
+/// This function will cause undefined behavior in the case where `cstr`'s data is no longer valid.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_string_push_cstr(
+    string: &mut NSTDString,
+    cstr: &NSTDCStrConst,
+) -> NSTDErrorCode {
+    let cstr_bytes = nstd_core_cstr_const_as_bytes(cstr);
+    // Make sure the C string slice's data is valid UTF-8.
+    let bytes = core::slice::from_raw_parts(cstr_bytes.ptr.raw.cast(), cstr_bytes.len);
+    if core::str::from_utf8(bytes).is_err() {
+        return 1;
+    }
+    // Append the C string slice's bytes to the end of the string.
+    match nstd_vec_extend(&mut string.bytes, &cstr_bytes) {
+        0 => 0,
+        _ => 2,
+    }
+}
+
+/// Appends a signed integer's base-10 representation to the end of a string.
+///
+/// The integer's digits are written directly into the string's buffer after a single reserve.
+///
+/// # Parameters:
+///
+/// - `NSTDString *string` - The string.
+///
+/// - `NSTDInt64 v` - The signed integer to append to the string.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_string_push_int(string: &mut NSTDString, v: NSTDInt64) -> NSTDErrorCode {
+    push_signed(&mut string.bytes, v)
+}
+
+/// Appends an unsigned integer's base-10 representation to the end of a string.
+///
+/// The integer's digits are written directly into the string's buffer after a single reserve.
+///
+/// # Parameters:
+///
+/// - `NSTDString *string` - The string.
+///
+/// - `NSTDUInt64 v` - The unsigned integer to append to the string.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_string_push_uint(string: &mut NSTDString, v: NSTDUInt64) -> NSTDErrorCode {
+    push_unsigned(&mut string.bytes, v)
+}
+
+/// Appends a floating point value's decimal representation to the end of a string.
+///
+/// # Parameters:
+///
+/// - `NSTDString *string` - The string.
+///
+/// - `NSTDFloat64 v` - The floating point value to append to the string.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_string_push_float(string: &mut NSTDString, v: NSTDFloat64) -> NSTDErrorCode {
+    push_f64(&mut string.bytes, v)
+}
+
+gen_from_primitive!(
+    /// Creates a new string containing the decimal representation of an `NSTDFloat32`.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDFloat32 v` - The 32-bit floating-point value.
+    ///
+    /// # Returns
+    ///
+    /// `NSTDString string` - The new string.
+    nstd_string_from_f32,
+    NSTDFloat32,
+    push_f32
+);
+gen_from_primitive!(
+    /// Creates a new string containing the decimal representation of an `NSTDFloat64`.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDFloat64 v` - The 64-bit floating-point value.
+    ///
+    /// # Returns
+    ///
+    /// `NSTDString string` - The new string.
+    nstd_string_from_f64,
+    NSTDFloat64,
+    push_f64
+);
+gen_from_primitive!(
+    /// Creates a new string containing the base-10 representation of an `NSTDUInt8`.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDUInt8 v` - The 8-bit unsigned integer.
+    ///
+    /// # Returns
+    ///
+    /// `NSTDString string` - The new string.
+    nstd_string_from_u8,
+    NSTDUInt8,
+    push_unsigned
+);
+gen_from_primitive!(
+    /// Creates a new string containing the base-10 representation of an `NSTDInt8`.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDInt8 v` - The 8-bit signed integer.
+    ///
+    /// # Returns
+    ///
+    /// `NSTDString string` - The new string.
+    nstd_string_from_i8,
+    NSTDInt8,
+    push_signed
+);
+gen_from_primitive!(
+    /// Creates a new string containing the base-10 representation of an `NSTDUInt16`.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDUInt16 v` - The 16-bit unsigned integer.
+    ///
+    /// # Returns
+    ///
+    /// `NSTDString string` - The new string.
+    nstd_string_from_u16,
+    NSTDUInt16,
+    push_unsigned
+);
+gen_from_primitive!(
+    /// Creates a new string containing the base-10 representation of an `NSTDInt16`.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDInt16 v` - The 16-bit signed integer.
+    ///
+    /// # Returns
+    ///
+    /// `NSTDString string` - The new string.
+    nstd_string_from_i16,
+    NSTDInt16,
+    push_signed
+);
+gen_from_primitive!(
+    /// Creates a new string containing the base-10 representation of an `NSTDUInt32`.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDUInt32 v` - The 32-bit unsigned integer.
+    ///
+    /// # Returns
+    ///
+    /// `NSTDString string` - The new string.
+    nstd_string_from_u32,
+    NSTDUInt32,
+    push_unsigned
+);
+gen_from_primitive!(
+    /// Creates a new string containing the base-10 representation of an `NSTDInt32`.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDInt32 v` - The 32-bit signed integer.
+    ///
+    /// # Returns
+    ///
+    /// `NSTDString string` - The new string.
+    nstd_string_from_i32,
+    NSTDInt32,
+    push_signed
+);
+gen_from_primitive!(
+    /// Creates a new string containing the base-10 representation of an `NSTDUInt64`.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDUInt64 v` - The 64-bit unsigned integer.
+    ///
+    /// # Returns
+    ///
+    /// `NSTDString string` - The new string.
+    nstd_string_from_u64,
+    NSTDUInt64,
+    push_unsigned
+);
+gen_from_primitive!(
+    /// Creates a new string containing the base-10 representation of an `NSTDInt64`.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDInt64 v` - The 64-bit signed integer.
+    ///
+    /// # Returns
+    ///
+    /// `NSTDString string` - The new string.
+    nstd_string_from_i64,
+    NSTDInt64,
+    push_signed
+);
+gen_from_primitive!(
+    /// Creates a new string containing the base-10 representation of an `NSTDUSize`.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDUSize v` - The arch-bit unsigned integer.
+    ///
+    /// # Returns
+    ///
+    /// `NSTDString string` - The new string.
+    nstd_string_from_usize,
+    NSTDUSize,
+    push_unsigned
+);
+gen_from_primitive!(
+    /// Creates a new string containing the base-10 representation of an `NSTDISize`.
+    ///
+    /// # Parameters:
+    ///
+    /// - `NSTDISize v` - The arch-bit signed integer.
+    ///
+    /// # Returns
+    ///
+    /// `NSTDString string` - The new string.
+    nstd_string_from_isize,
+    NSTDISize,
+    push_signed
+);
+
 /// Removes the last character from a string and returns it.
 ///
 /// # Parameters:
@@ -0,0 +1,303 @@
+//! A string builder that assembles large strings from a list of segments.
+//!
+//! Appended data is written into a list of fixed-size chunks, so growing the builder never
+//! copies previously appended bytes the way growing an `NSTDString` in place does. String slices
+//! with a stable address (static template fragments, interned strings, etc.) can be appended by
+//! reference without copying at all. The final contiguous string is materialized with a single
+//! exact allocation and one gather pass, or the segments can be streamed out directly without
+//! ever materializing.
+use crate::{
+    alloc::{nstd_alloc_allocate, nstd_alloc_deallocate},
+    core::{
+        def::NSTDErrorCode,
+        mem::nstd_core_mem_copy,
+        slice::nstd_core_slice_const_new,
+        str::{
+            nstd_core_str_const_as_bytes, nstd_core_str_const_from_bytes_unchecked, NSTDStrConst,
+        },
+    },
+    string::{nstd_string_new, NSTDString},
+    vec::{
+        nstd_vec_cap, nstd_vec_extend, nstd_vec_get, nstd_vec_get_mut, nstd_vec_len, nstd_vec_new,
+        nstd_vec_new_with_cap, nstd_vec_push, NSTDVec,
+    },
+    NSTDAnyConst, NSTDAnyMut, NSTDUSize,
+};
+use core::mem::size_of;
+
+/// The size in bytes of each chunk allocated by a string builder.
+const CHUNK_SIZE: usize = 4096;
+
+/// A single segment of a string builder's contents.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Hash)]
+struct Segment {
+    /// A pointer to the segment's UTF-8 encoded data.
+    ptr: NSTDAnyConst,
+    /// The number of active bytes in the segment.
+    len: NSTDUSize,
+    /// The segment's capacity in bytes, or 0 if the segment's data is borrowed.
+    cap: NSTDUSize,
+}
+
+/// A string builder that assembles large strings from a list of segments.
+#[repr(C)]
+#[derive(Debug, Hash)]
+pub struct NSTDStringBuilder {
+    /// The builder's list of segments.
+    segments: NSTDVec,
+    /// The total number of bytes in the builder.
+    byte_len: NSTDUSize,
+}
+impl NSTDStringBuilder {
+    /// Reads the segment at index `pos` in the builder's segment list.
+    ///
+    /// # Safety
+    ///
+    /// `pos` must be within the segment list's boundaries.
+    #[inline]
+    unsafe fn segment(&self, pos: usize) -> Segment {
+        // The segment list is byte aligned, so the segment must be read unaligned.
+        nstd_vec_get(&self.segments, pos)
+            .cast::<Segment>()
+            .read_unaligned()
+    }
+}
+impl Drop for NSTDStringBuilder {
+    /// [NSTDStringBuilder]'s destructor.
+    fn drop(&mut self) {
+        for i in 0..nstd_vec_len(&self.segments) {
+            // SAFETY: `i` is within the segment list's boundaries.
+            let mut segment = unsafe { self.segment(i) };
+            // Borrowed segments have a capacity of 0 and are not owned by the builder.
+            if segment.cap > 0 {
+                // SAFETY: The chunk was allocated with `nstd_alloc_allocate`.
+                unsafe {
+                    let mut ptr = segment.ptr as NSTDAnyMut;
+                    nstd_alloc_deallocate(&mut ptr, segment.cap);
+                    segment.ptr = ptr;
+                }
+            }
+        }
+    }
+}
+
+/// A function used to stream a string builder's segments.
+///
+/// The first parameter is a string slice over the segment's data and the second parameter is the
+/// user data that was passed along with the function.
+pub type NSTDStringBuilderWriter = extern "C" fn(&NSTDStrConst, NSTDAnyMut);
+
+/// Creates a new empty string builder.
+///
+/// # Returns
+///
+/// `NSTDStringBuilder builder` - The new string builder.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_string_builder_new() -> NSTDStringBuilder {
+    NSTDStringBuilder {
+        segments: nstd_vec_new(size_of::<Segment>()),
+        byte_len: 0,
+    }
+}
+
+/// Returns the total number of bytes in a string builder.
+///
+/// # Parameters:
+///
+/// - `const NSTDStringBuilder *builder` - The string builder.
+///
+/// # Returns
+///
+/// `NSTDUSize byte_len` - The total number of bytes appended to the builder.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_string_builder_byte_len(builder: &NSTDStringBuilder) -> NSTDUSize {
+    builder.byte_len
+}
+
+/// Appends a copy of a string slice to the end of a string builder.
+///
+/// The bytes are copied into the builder's active chunk when they fit, otherwise a new chunk is
+/// allocated. Previously appended data is never moved. Appends are never split across chunks so
+/// each of the builder's segments remains valid UTF-8 on it's own.
+///
+/// # Parameters:
+///
+/// - `NSTDStringBuilder *builder` - The string builder.
+///
+/// - `const NSTDStrConst *str` - The string slice to append.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `str`'s data is invalid.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_string_builder_append(
+    builder: &mut NSTDStringBuilder,
+    str: &NSTDStrConst,
+) -> NSTDErrorCode {
+    let bytes = nstd_core_str_const_as_bytes(str);
+    if bytes.len == 0 {
+        return 0;
+    }
+    // Append to the last segment if it's an owned chunk with enough spare capacity.
+    let segments = nstd_vec_len(&builder.segments);
+    if segments > 0 {
+        let mut segment = builder.segment(segments - 1);
+        // Borrowed segments have a capacity of 0 and are never appended to.
+        if segment.cap >= segment.len + bytes.len {
+            let dest = (segment.ptr as NSTDAnyMut).add(segment.len);
+            nstd_core_mem_copy(dest.cast(), bytes.ptr.raw.cast(), bytes.len);
+            segment.len += bytes.len;
+            let last = nstd_vec_get_mut(&mut builder.segments, segments - 1);
+            last.cast::<Segment>().write_unaligned(segment);
+            builder.byte_len += bytes.len;
+            return 0;
+        }
+    }
+    // Allocate a new chunk for the bytes.
+    let cap = bytes.len.max(CHUNK_SIZE);
+    let mem = nstd_alloc_allocate(cap);
+    if mem.is_null() {
+        return 1;
+    }
+    nstd_core_mem_copy(mem.cast(), bytes.ptr.raw.cast(), bytes.len);
+    let segment = Segment {
+        ptr: mem,
+        len: bytes.len,
+        cap,
+    };
+    let segment_ptr: *const Segment = &segment;
+    if nstd_vec_push(&mut builder.segments, segment_ptr.cast()) != 0 {
+        let mut mem = mem;
+        nstd_alloc_deallocate(&mut mem, cap);
+        return 1;
+    }
+    builder.byte_len += bytes.len;
+    0
+}
+
+/// Appends a string slice to the end of a string builder by reference, without copying it's data.
+///
+/// # Parameters:
+///
+/// - `NSTDStringBuilder *builder` - The string builder.
+///
+/// - `const NSTDStrConst *str` - The string slice to append by reference.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// `str`'s data must remain valid and unmodified for the lifetime of the builder and anything
+/// built from it's segments.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_string_builder_append_borrowed(
+    builder: &mut NSTDStringBuilder,
+    str: &NSTDStrConst,
+) -> NSTDErrorCode {
+    let bytes = nstd_core_str_const_as_bytes(str);
+    if bytes.len == 0 {
+        return 0;
+    }
+    let segment = Segment {
+        ptr: bytes.ptr.raw,
+        len: bytes.len,
+        cap: 0,
+    };
+    let segment_ptr: *const Segment = &segment;
+    if nstd_vec_push(&mut builder.segments, segment_ptr.cast()) != 0 {
+        return 1;
+    }
+    builder.byte_len += bytes.len;
+    0
+}
+
+/// Streams each of a string builder's segments through `writer` in order, without materializing
+/// a contiguous string.
+///
+/// # Parameters:
+///
+/// - `const NSTDStringBuilder *builder` - The string builder.
+///
+/// - `NSTDStringBuilderWriter writer` - The function to stream each segment through.
+///
+/// - `NSTDAnyMut data` - User data to pass along with each segment.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if any of the builder's borrowed segments have
+/// been invalidated.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_string_builder_for_each(
+    builder: &NSTDStringBuilder,
+    writer: NSTDStringBuilderWriter,
+    data: NSTDAnyMut,
+) {
+    for i in 0..nstd_vec_len(&builder.segments) {
+        // SAFETY: `i` is within the segment list's boundaries.
+        let segment = builder.segment(i);
+        let bytes = nstd_core_slice_const_new(segment.ptr, 1, segment.len);
+        // SAFETY: Each segment holds complete appends, so it's data is valid UTF-8.
+        let str = nstd_core_str_const_from_bytes_unchecked(&bytes);
+        writer(&str, data);
+    }
+}
+
+/// Materializes a string builder's contents into a contiguous `NSTDString`, taking ownership of
+/// the builder.
+///
+/// The string's buffer is created with a single exact allocation and filled with one gather pass
+/// over the builder's segments.
+///
+/// # Parameters:
+///
+/// - `NSTDStringBuilder builder` - The string builder to materialize.
+///
+/// # Returns
+///
+/// `NSTDString string` - The materialized string.
+///
+/// # Panics
+///
+/// This operation will panic if allocating for the new string fails.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if any of the builder's borrowed segments have
+/// been invalidated.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_string_builder_build(builder: NSTDStringBuilder) -> NSTDString {
+    if builder.byte_len == 0 {
+        return nstd_string_new();
+    }
+    let mut bytes = nstd_vec_new_with_cap(1, builder.byte_len);
+    // `nstd_vec_new_with_cap` returns a "null vector" on allocation failure.
+    assert!(nstd_vec_cap(&bytes) == builder.byte_len);
+    // Gather each segment into the string's buffer, the exact allocation above guarantees that
+    // this never reallocates.
+    for i in 0..nstd_vec_len(&builder.segments) {
+        // SAFETY: `i` is within the segment list's boundaries.
+        let segment = builder.segment(i);
+        let slice = nstd_core_slice_const_new(segment.ptr, 1, segment.len);
+        nstd_vec_extend(&mut bytes, &slice);
+    }
+    NSTDString { bytes }
+}
+
+/// Frees an instance of `NSTDStringBuilder`, along with all of it's owned chunks.
+///
+/// # Parameters:
+///
+/// - `NSTDStringBuilder builder` - The string builder to free.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+#[allow(unused_variables)]
+pub extern "C" fn nstd_string_builder_free(builder: NSTDStringBuilder) {}
@@ -0,0 +1,200 @@
+//! A copy-on-write wrapper around [NSTDString][crate::string::NSTDString].
+//!
+//! Cloning an `NSTDCowString` shares the underlying byte buffer between the clones, making clones
+//! O(1) and allocation free. A private copy of the buffer is only materialized once a mutable
+//! operation is invoked, so strings that are cloned often but rarely mutated (configuration
+//! values, templates, etc.) never pay for the copy.
+use crate::{
+    core::{
+        def::NSTDErrorCode,
+        slice::nstd_core_slice_const_new,
+        str::{
+            nstd_core_str_const_from_bytes_unchecked, nstd_core_str_mut_from_bytes_unchecked,
+            NSTDStrConst, NSTDStrMut,
+        },
+    },
+    string::NSTDString,
+    vec::cow::{
+        nstd_cow_vec_as_slice, nstd_cow_vec_as_slice_mut, nstd_cow_vec_clone, nstd_cow_vec_extend,
+        nstd_cow_vec_from_vec, nstd_cow_vec_into_vec, nstd_cow_vec_len, nstd_cow_vec_owners,
+        NSTDCowVec,
+    },
+    NSTDUSize, NSTDUnichar,
+};
+
+/// A copy-on-write wrapper around [NSTDString][crate::string::NSTDString].
+#[repr(C)]
+#[derive(Debug, Hash)]
+pub struct NSTDCowString {
+    /// The underlying copy-on-write UTF-8 encoded byte buffer.
+    bytes: NSTDCowVec,
+}
+
+/// Creates a new copy-on-write string, taking ownership of `string`.
+///
+/// # Parameters:
+///
+/// - `NSTDString string` - The string to wrap.
+///
+/// # Returns
+///
+/// `NSTDCowString cow` - The new copy-on-write string.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_cow_string_from_string(string: NSTDString) -> NSTDCowString {
+    NSTDCowString {
+        bytes: nstd_cow_vec_from_vec(string.bytes),
+    }
+}
+
+/// Creates a new clone of `cow` that shares it's buffer.
+///
+/// This operation is O(1) and does not copy the string's bytes, the buffer is shared between the
+/// clones until one of them is mutated.
+///
+/// # Parameters:
+///
+/// - `NSTDCowString *cow` - The string to clone.
+///
+/// # Returns
+///
+/// `NSTDCowString cloned` - The new clone of `cow`.
+///
+/// # Panics
+///
+/// This operation will panic if allocating space for the owner count fails.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_cow_string_clone(cow: &mut NSTDCowString) -> NSTDCowString {
+    NSTDCowString {
+        bytes: nstd_cow_vec_clone(&mut cow.bytes),
+    }
+}
+
+/// Returns the number of strings sharing `cow`'s buffer.
+///
+/// # Parameters:
+///
+/// - `const NSTDCowString *cow` - The copy-on-write string.
+///
+/// # Returns
+///
+/// `NSTDUSize owners` - The number of strings sharing `cow`'s buffer, 1 if the buffer is
+/// privately owned.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_cow_string_owners(cow: &NSTDCowString) -> NSTDUSize {
+    nstd_cow_vec_owners(&cow.bytes)
+}
+
+/// Returns the number of bytes in a copy-on-write string.
+///
+/// # Parameters:
+///
+/// - `const NSTDCowString *cow` - The copy-on-write string.
+///
+/// # Returns
+///
+/// `NSTDUSize byte_len` - The number of bytes in the string.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_cow_string_byte_len(cow: &NSTDCowString) -> NSTDUSize {
+    nstd_cow_vec_len(&cow.bytes)
+}
+
+/// Returns an immutable string slice containing a copy-on-write string's data.
+///
+/// This operation never materializes a private copy.
+///
+/// # Parameters:
+///
+/// - `const NSTDCowString *cow` - The copy-on-write string.
+///
+/// # Returns
+///
+/// `NSTDStrConst str` - An *immutable* view into the string.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_cow_string_as_str(cow: &NSTDCowString) -> NSTDStrConst {
+    let bytes = nstd_cow_vec_as_slice(&cow.bytes);
+    // SAFETY: The string's bytes are always UTF-8 encoded.
+    unsafe { nstd_core_str_const_from_bytes_unchecked(&bytes) }
+}
+
+/// Returns a mutable string slice containing a copy-on-write string's data, materializing a
+/// private copy of the buffer if it is currently shared.
+///
+/// # Parameters:
+///
+/// - `NSTDCowString *cow` - The copy-on-write string.
+///
+/// # Returns
+///
+/// `NSTDStrMut str` - A *mutable* view into the string, or an empty string slice if materializing
+/// a private copy of the buffer fails.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_cow_string_as_str_mut(cow: &mut NSTDCowString) -> NSTDStrMut {
+    let mut bytes = nstd_cow_vec_as_slice_mut(&mut cow.bytes);
+    // SAFETY: The string's bytes are always UTF-8 encoded.
+    unsafe { nstd_core_str_mut_from_bytes_unchecked(&mut bytes) }
+}
+
+/// Pushes an `NSTDUnichar` onto the end of a copy-on-write string, materializing a private copy
+/// of the buffer if it is currently shared.
+///
+/// # Parameters:
+///
+/// - `NSTDCowString *cow` - The copy-on-write string.
+///
+/// - `NSTDUnichar chr` - The Unicode character to append to the string.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_cow_string_push(cow: &mut NSTDCowString, chr: NSTDUnichar) -> NSTDErrorCode {
+    if let Some(chr) = char::from_u32(chr) {
+        let mut buf = [0; 4];
+        chr.encode_utf8(&mut buf);
+        let buf = nstd_core_slice_const_new(buf.as_ptr().cast(), 1, chr.len_utf8());
+        // SAFETY: `buf` contains `chr`'s UTF-8 encoding.
+        return unsafe { nstd_cow_vec_extend(&mut cow.bytes, &buf) };
+    }
+    1
+}
+
+/// Returns ownership of a copy-on-write string's data as an `NSTDString`, taking ownership of
+/// `cow`.
+///
+/// If the buffer is privately owned this is a simple handoff, otherwise a private copy of the
+/// buffer is materialized first.
+///
+/// # Parameters:
+///
+/// - `NSTDCowString cow` - The copy-on-write string.
+///
+/// # Returns
+///
+/// `NSTDString string` - A string that privately owns the data.
+///
+/// # Panics
+///
+/// This operation will panic if materializing a private copy of the buffer fails.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_cow_string_into_string(cow: NSTDCowString) -> NSTDString {
+    NSTDString {
+        bytes: nstd_cow_vec_into_vec(cow.bytes),
+    }
+}
+
+/// Frees an instance of `NSTDCowString`.
+///
+/// # Parameters:
+///
+/// - `NSTDCowString cow` - The copy-on-write string to free.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+#[allow(unused_variables)]
+pub extern "C" fn nstd_cow_string_free(cow: NSTDCowString) {}
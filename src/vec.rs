@@ -1,14 +1,31 @@
 //! A dynamically sized contiguous sequence of values.
+pub mod cow;
+pub mod small;
 use crate::{
-    alloc::{nstd_alloc_allocate, nstd_alloc_deallocate, nstd_alloc_reallocate},
+    alloc::{
+        nstd_alloc_allocate, nstd_alloc_allocate_aligned, nstd_alloc_allocate_zeroed,
+        nstd_alloc_deallocate, nstd_alloc_deallocate_aligned, nstd_alloc_reallocate,
+        nstd_alloc_reallocate_aligned,
+    },
     core::{
         def::{NSTDByte, NSTDErrorCode},
         mem::{nstd_core_mem_copy, nstd_core_mem_copy_overlapping},
+        range::NSTDURange,
         slice::{nstd_core_slice_const_new, nstd_core_slice_mut_new, NSTDSliceConst, NSTDSliceMut},
     },
-    NSTDAnyConst, NSTDAnyMut, NSTDUSize, NSTD_NULL,
+    NSTDAnyConst, NSTDAnyMut, NSTDBool, NSTDUSize, NSTD_FALSE, NSTD_NULL,
 };
 
+/// A predicate over a vector's elements.
+///
+/// The first parameter is a pointer to the element being tested and the second parameter is the
+/// user data that was passed along with the predicate. The predicate shall return `NSTD_TRUE` to
+/// keep the element.
+pub type NSTDVecPredicate = extern "C" fn(NSTDAnyConst, NSTDAnyMut) -> NSTDBool;
+
+/// The default growth factor for new vectors, growing the capacity by at least half.
+pub(crate) const DEFAULT_GROWTH: NSTDUSize = 150;
+
 /// A dynamically sized contiguous sequence of values.
 #[repr(C)]
 #[derive(Debug, Hash)]
@@ -17,6 +34,12 @@ pub struct NSTDVec {
     buffer: NSTDSliceMut,
     /// The number of active elements in the vector.
     len: NSTDUSize,
+    /// The alignment (in bytes) of the vector's memory buffer.
+    align: NSTDUSize,
+    /// The vector's growth factor as a percentage of it's current capacity, at least 100.
+    growth: NSTDUSize,
+    /// The minimum number of spare elements kept as headroom when the vector is shrunk.
+    min_slack: NSTDUSize,
 }
 impl NSTDVec {
     /// Returns the number of active bytes in the vector.
@@ -41,12 +64,48 @@ impl NSTDVec {
         self.buffer.ptr.raw.add(self.byte_len())
     }
 
+    /// Creates a new `NSTDVec` directly from a fully initialized byte buffer.
+    ///
+    /// # Safety
+    ///
+    /// `buffer`'s data must have been allocated by the `nstd_alloc` functions with an alignment
+    /// of 1 and `buffer.len` must match the allocation's size in bytes.
+    #[inline]
+    #[cfg(feature = "nstd_heap_ptr")]
+    pub(crate) unsafe fn from_buffer(buffer: NSTDSliceMut) -> Self {
+        let len = buffer.len;
+        Self {
+            buffer,
+            len,
+            align: 1,
+            growth: DEFAULT_GROWTH,
+            min_slack: 0,
+        }
+    }
+
+    /// Returns the number of elements the vector can hold without reallocating.
+    #[inline]
+    pub(crate) fn cap(&self) -> usize {
+        self.buffer.len
+    }
+
+    /// Sets the number of active elements in the vector.
+    ///
+    /// # Safety
+    ///
+    /// The first `len` elements of the vector's buffer must be initialized.
+    #[inline]
+    pub(crate) unsafe fn set_len(&mut self, len: usize) {
+        self.len = len;
+    }
+
     /// Attempts to reserve some memory for the vector if needed.
     #[inline]
     pub(crate) fn try_reserve(&mut self) -> NSTDErrorCode {
         if self.len == self.buffer.len {
-            let additional = 1 + self.buffer.len / 2;
-            return nstd_vec_reserve(self, additional);
+            #[cfg(feature = "nstd_alloc_stats")]
+            crate::alloc::stats::record_vec_growth();
+            return nstd_vec_reserve(self, 1);
         }
         0
     }
@@ -94,7 +153,14 @@ impl Drop for NSTDVec {
     fn drop(&mut self) {
         if !self.buffer.ptr.raw.is_null() {
             let buffer_len = self.buffer.byte_len();
-            unsafe { nstd_alloc_deallocate(&mut self.buffer.ptr.raw, buffer_len) };
+            match self.align > 1 {
+                // SAFETY: The buffer was allocated with `self.align` alignment.
+                true => unsafe {
+                    nstd_alloc_deallocate_aligned(&mut self.buffer.ptr.raw, buffer_len, self.align)
+                },
+                // SAFETY: The vector's buffer is non-null.
+                false => unsafe { nstd_alloc_deallocate(&mut self.buffer.ptr.raw, buffer_len) },
+            }
         }
     }
 }
@@ -119,6 +185,9 @@ pub extern "C" fn nstd_vec_new(element_size: NSTDUSize) -> NSTDVec {
     NSTDVec {
         buffer: nstd_core_slice_mut_new(NSTD_NULL, element_size, 0),
         len: 0,
+        align: 1,
+        growth: DEFAULT_GROWTH,
+        min_slack: 0,
     }
 }
 
@@ -156,6 +225,105 @@ pub extern "C" fn nstd_vec_new_with_cap(element_size: NSTDUSize, mut cap: NSTDUS
     NSTDVec {
         buffer: nstd_core_slice_mut_new(mem, element_size, cap),
         len: 0,
+        align: 1,
+        growth: DEFAULT_GROWTH,
+        min_slack: 0,
+    }
+}
+
+/// Creates a new vector of `len` zero-initialized elements.
+///
+/// The buffer is requested from the allocator already zeroed, letting the operating system hand
+/// over zero pages directly instead of the vector zeroing the memory itself.
+///
+/// # Note
+///
+/// This will return a "null vector" (a vector that has not allocated yet) on error.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize element_size` - The size in bytes of each value in the vector.
+///
+/// - `NSTDUSize len` - The number of zero-initialized elements in the vector.
+///
+/// # Returns
+///
+/// `NSTDVec vec` - The new vector.
+///
+/// # Panics
+///
+/// This function will panic if either `element_size` or `len` are zero.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_vec_new_with_len_zeroed(element_size: NSTDUSize, len: NSTDUSize) -> NSTDVec {
+    // Ensure that neither `element_size` or `len` are zero.
+    assert!(element_size != 0);
+    assert!(len != 0);
+    // Attempt to allocate the zeroed memory buffer.
+    let mem = unsafe { nstd_alloc_allocate_zeroed(len * element_size) };
+    let cap = match mem.is_null() {
+        true => 0,
+        false => len,
+    };
+    // Construct the vector, the zeroed elements are active.
+    NSTDVec {
+        buffer: nstd_core_slice_mut_new(mem, element_size, cap),
+        len: cap,
+        align: 1,
+        growth: DEFAULT_GROWTH,
+        min_slack: 0,
+    }
+}
+
+/// Creates a new vector initialized with the given capacity, whose memory buffer is aligned to
+/// `align` bytes.
+///
+/// The buffer's alignment is preserved when the vector's capacity grows.
+///
+/// # Note
+///
+/// This will return a "null vector" (a vector that has not allocated yet) on error.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize element_size` - The size in bytes of each value in the vector.
+///
+/// - `NSTDUSize align` - The alignment (in bytes) of the vector's memory buffer.
+///
+/// - `NSTDUSize cap` - The initial capacity for the vector.
+///
+/// # Returns
+///
+/// `NSTDVec vec` - The new vector.
+///
+/// # Panics
+///
+/// This function will panic if either `element_size` or `cap` are zero, or `align` is not a power
+/// of two.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_vec_new_aligned(
+    element_size: NSTDUSize,
+    align: NSTDUSize,
+    mut cap: NSTDUSize,
+) -> NSTDVec {
+    // Ensure that neither `element_size` or `cap` are zero and `align` is a power of two.
+    assert!(element_size != 0);
+    assert!(cap != 0);
+    assert!(align != 0 && (align & (align - 1)) == 0);
+    // Attempt to allocate the memory buffer.
+    // SAFETY: Both the allocation size and `align` have been checked.
+    let mem = unsafe { nstd_alloc_allocate_aligned(cap * element_size, align) };
+    if mem.is_null() {
+        cap = 0;
+    }
+    // Construct the vector.
+    NSTDVec {
+        buffer: nstd_core_slice_mut_new(mem, element_size, cap),
+        len: 0,
+        align,
+        growth: DEFAULT_GROWTH,
+        min_slack: 0,
     }
 }
 
@@ -175,7 +343,10 @@ pub extern "C" fn nstd_vec_new_with_cap(element_size: NSTDUSize, mut cap: NSTDUS
 #[cfg_attr(feature = "clib", no_mangle)]
 pub extern "C" fn nstd_vec_clone(vec: &NSTDVec) -> NSTDVec {
     if !vec.buffer.ptr.raw.is_null() {
-        let mut cloned = nstd_vec_new_with_cap(vec.buffer.ptr.size, vec.buffer.len);
+        let mut cloned = match vec.align > 1 {
+            true => nstd_vec_new_aligned(vec.buffer.ptr.size, vec.align, vec.buffer.len),
+            false => nstd_vec_new_with_cap(vec.buffer.ptr.size, vec.buffer.len),
+        };
         assert!(!cloned.buffer.ptr.raw.is_null());
         unsafe {
             nstd_core_mem_copy(
@@ -206,6 +377,23 @@ pub extern "C" fn nstd_vec_len(vec: &NSTDVec) -> NSTDUSize {
     vec.len
 }
 
+/// Returns a vector's capacity.
+///
+/// This is the number of elements the vector can contain without reallocating.
+///
+/// # Parameters:
+///
+/// - `const NSTDVec *vec` - The vector.
+///
+/// # Returns
+///
+/// `NSTDUSize cap` - The vector's capacity.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_vec_cap(vec: &NSTDVec) -> NSTDUSize {
+    vec.buffer.len
+}
+
 /// Returns an immutable slice containing all of a vector's active elements.
 ///
 /// # Parameters:
@@ -456,6 +644,79 @@ pub extern "C" fn nstd_vec_remove(vec: &mut NSTDVec, index: NSTDUSize) -> NSTDEr
     }
 }
 
+/// Removes the element at `index` in a vector by replacing it with the last element.
+///
+/// Unlike `nstd_vec_remove` this operation is O(1), but it does not preserve the order of the
+/// vector's elements.
+///
+/// # Parameters:
+///
+/// - `NSTDVec *vec` - The vector.
+///
+/// - `NSTDUSize index` - The index of the element to remove.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero if `index` is invalid.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_vec_swap_remove(vec: &mut NSTDVec, index: NSTDUSize) -> NSTDErrorCode {
+    // Make sure `index` is valid. This also ensures that `vec.len` is at least 1.
+    if index < vec.len {
+        vec.len -= 1;
+        // Copy the last element into the hole, unless the last element was removed.
+        if index < vec.len {
+            let size = vec.buffer.ptr.size;
+            // SAFETY: Both `index` and the old last element are within the vector's boundaries.
+            unsafe {
+                let hole = vec.buffer.ptr.raw.add(index * size);
+                nstd_core_mem_copy(hole.cast(), vec.end().cast(), size);
+            }
+        }
+        0
+    } else {
+        1
+    }
+}
+
+/// Keeps only the elements of a vector for which `predicate` returns `NSTD_TRUE`, compacting the
+/// vector in a single pass.
+///
+/// The order of the retained elements is preserved.
+///
+/// # Parameters:
+///
+/// - `NSTDVec *vec` - The vector to filter.
+///
+/// - `NSTDVecPredicate predicate` - The predicate to test each element with.
+///
+/// - `NSTDAnyMut ctx` - User data to pass to the predicate on each call.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `vec`'s data is invalid.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_vec_retain(
+    vec: &mut NSTDVec,
+    predicate: NSTDVecPredicate,
+    ctx: NSTDAnyMut,
+) {
+    let size = vec.buffer.ptr.size;
+    let mut write = 0;
+    for read in 0..vec.len {
+        let element = vec.buffer.ptr.raw.add(read * size);
+        if predicate(element, ctx) != NSTD_FALSE {
+            // Shift the retained element down to the write cursor.
+            if write != read {
+                let dest = vec.buffer.ptr.raw.add(write * size);
+                nstd_core_mem_copy(dest.cast(), element.cast(), size);
+            }
+            write += 1;
+        }
+    }
+    vec.len = write;
+}
+
 /// Pushes a series of values onto a vector.
 ///
 /// # Parameters:
@@ -497,6 +758,223 @@ pub unsafe extern "C" fn nstd_vec_extend(
     errc
 }
 
+/// Extends a vector with `count` uninitialized elements, returning a slice over the new tail.
+///
+/// The vector's length is bumped before returning so decoders can write their output directly
+/// into the vector's buffer, without staging through a scratch buffer and copying it over with
+/// `nstd_vec_extend`.
+///
+/// # Parameters:
+///
+/// - `NSTDVec *vec` - The vector to extend.
+///
+/// - `NSTDUSize count` - The number of uninitialized elements to append.
+///
+/// # Returns
+///
+/// `NSTDSliceMut slice` - A *mutable* view over the `count` new elements, or an empty slice if
+/// reserving memory for the extension fails.
+///
+/// # Safety
+///
+/// The new elements are uninitialized, the caller must initialize them before they are read.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_vec_extend_uninit(
+    vec: &mut NSTDVec,
+    count: NSTDUSize,
+) -> NSTDSliceMut {
+    // Making sure there's enough space for the extension.
+    let reserved = vec.buffer.len - vec.len;
+    if reserved < count && nstd_vec_reserve(vec, count - reserved) != 0 {
+        return nstd_core_slice_mut_new(NSTD_NULL, vec.buffer.ptr.size, 0);
+    }
+    let start = vec.end();
+    vec.len += count;
+    nstd_core_slice_mut_new(start, vec.buffer.ptr.size, count)
+}
+
+/// Splits a vector in two at `index`, returning a new vector that takes ownership of all
+/// elements at and after `index`.
+///
+/// When `index` is 0 this is a simple buffer handoff, leaving `vec` as a "null vector", otherwise
+/// the tail elements are moved into the new vector with a single copy.
+///
+/// # Note
+///
+/// This will return a "null vector" (a vector that has not allocated yet) on error.
+///
+/// # Parameters:
+///
+/// - `NSTDVec *vec` - The vector to split.
+///
+/// - `NSTDUSize index` - The index at which to split the vector.
+///
+/// # Returns
+///
+/// `NSTDVec tail` - A new vector containing the elements of `vec` starting at `index`.
+///
+/// # Panics
+///
+/// This operation will panic if `index` is greater than `vec`'s length.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_vec_split_off(vec: &mut NSTDVec, index: NSTDUSize) -> NSTDVec {
+    // Make sure `index` is valid.
+    assert!(index <= vec.len);
+    let element_size = vec.buffer.ptr.size;
+    // Splitting at the front hands the whole buffer over to the new vector.
+    if index == 0 && !vec.buffer.ptr.raw.is_null() {
+        let empty = NSTDVec {
+            buffer: nstd_core_slice_mut_new(NSTD_NULL, element_size, 0),
+            len: 0,
+            align: vec.align,
+            growth: vec.growth,
+            min_slack: vec.min_slack,
+        };
+        return core::mem::replace(vec, empty);
+    }
+    // Otherwise move the tail elements into a freshly allocated vector.
+    let tail_len = vec.len - index;
+    if tail_len > 0 {
+        let mut tail = match vec.align > 1 {
+            true => nstd_vec_new_aligned(element_size, vec.align, tail_len),
+            false => nstd_vec_new_with_cap(element_size, tail_len),
+        };
+        if !tail.buffer.ptr.raw.is_null() {
+            // SAFETY: The tail elements are within the vector's boundaries.
+            unsafe {
+                let src = vec.buffer.ptr.raw.add(index * element_size);
+                nstd_core_mem_copy(
+                    tail.buffer.ptr.raw.cast(),
+                    src.cast(),
+                    tail_len * element_size,
+                );
+            }
+            tail.len = tail_len;
+            vec.len = index;
+        }
+        tail
+    } else {
+        nstd_vec_new(element_size)
+    }
+}
+
+/// Moves a range of elements out of a vector and into `dst`, compacting the vector in a single
+/// pass.
+///
+/// # Parameters:
+///
+/// - `NSTDVec *vec` - The vector to drain.
+///
+/// - `NSTDURange range` - The range of elements to move out of the vector.
+///
+/// - `NSTDSliceMut *dst` - The slice to move the drained elements into.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Possible errors
+///
+/// - `1` - `range` is out of the vector's boundaries or `range.start` is greater than `range.end`.
+///
+/// - `2` - `dst` is too small to hold the drained elements.
+///
+/// # Panics
+///
+/// This operation will panic if the element sizes for `vec` and `dst` do not match.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `dst`'s data is invalid.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_vec_drain(
+    vec: &mut NSTDVec,
+    range: NSTDURange,
+    dst: &mut NSTDSliceMut,
+) -> NSTDErrorCode {
+    // Ensure value sizes are the same for both the vector and the slice.
+    assert!(vec.buffer.ptr.size == dst.ptr.size);
+    // Make sure `range` is valid for the bounds of `vec`.
+    if range.end > vec.len || range.start > range.end {
+        return 1;
+    }
+    // Make sure `dst` can hold the drained elements.
+    let drained = range.end - range.start;
+    if dst.len < drained {
+        return 2;
+    }
+    let size = vec.buffer.ptr.size;
+    let startptr = vec
+        .buffer
+        .ptr
+        .raw
+        .add(range.start * size)
+        .cast::<NSTDByte>();
+    // Move the drained elements into `dst`.
+    nstd_core_mem_copy(dst.ptr.raw.cast(), startptr, drained * size);
+    // Shift the elements after the range down to close the gap.
+    let bytes_to_copy = (vec.len - range.end) * size;
+    let src = vec.buffer.ptr.raw.add(range.end * size).cast::<NSTDByte>();
+    nstd_core_mem_copy_overlapping(startptr, src, bytes_to_copy);
+    vec.len -= drained;
+    0
+}
+
+/// Appends a range of elements from `src` onto the end of `dest` with a single copy.
+///
+/// # Parameters:
+///
+/// - `NSTDVec *dest` - The vector to copy the elements into.
+///
+/// - `const NSTDVec *src` - The vector to copy the elements from.
+///
+/// - `NSTDURange range` - The range of elements in `src` to copy.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Possible errors
+///
+/// - `1` - `range` is out of `src`'s boundaries or `range.start` is greater than `range.end`.
+///
+/// - `2` - Reserving memory for the new elements fails.
+///
+/// # Panics
+///
+/// This operation will panic if the element sizes for `dest` and `src` do not match.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_vec_copy_range(
+    dest: &mut NSTDVec,
+    src: &NSTDVec,
+    range: NSTDURange,
+) -> NSTDErrorCode {
+    // Ensure value sizes are the same for both vectors.
+    assert!(dest.buffer.ptr.size == src.buffer.ptr.size);
+    // Make sure `range` is valid for the bounds of `src`.
+    if range.end > src.len || range.start > range.end {
+        return 1;
+    }
+    let count = range.end - range.start;
+    if count == 0 {
+        return 0;
+    }
+    // Making sure there's enough space for the new elements.
+    let reserved = dest.buffer.len - dest.len;
+    if reserved < count && nstd_vec_reserve(dest, count - reserved) != 0 {
+        return 2;
+    }
+    let size = dest.buffer.ptr.size;
+    // SAFETY: `range` has been checked against `src`'s boundaries and the reserve above
+    // guarantees room for `count` more elements.
+    unsafe {
+        let srcptr = src.buffer.ptr.raw.add(range.start * size);
+        nstd_core_mem_copy(dest.end().cast(), srcptr.cast(), count * size);
+    }
+    dest.len += count;
+    0
+}
+
 /// Shortens a vector, keeping the first `len` elements.
 ///
 /// # Note
@@ -516,9 +994,48 @@ pub extern "C" fn nstd_vec_truncate(vec: &mut NSTDVec, len: NSTDUSize) {
     }
 }
 
+/// Returns ownership of a vector's buffer as a heap object, taking ownership of said vector.
+///
+/// The vector's buffer is shrunk to match it's active length and handed to the heap pointer
+/// without copying. The size of the returned heap object is the vector's length in bytes.
+///
+/// # Parameters:
+///
+/// - `NSTDVec vec` - The vector.
+///
+/// # Returns
+///
+/// `NSTDHeapPtr hptr` - A heap object that owns the vector's data, or an empty heap pointer if
+/// `vec` is a "null vector".
+///
+/// # Panics
+///
+/// This operation will panic if `vec`'s buffer is aligned above one byte or shrinking the buffer
+/// fails.
+#[cfg_attr(feature = "clib", no_mangle)]
+#[cfg(feature = "nstd_heap_ptr")]
+#[cfg_attr(doc_cfg, doc(cfg(feature = "nstd_heap_ptr")))]
+pub extern "C" fn nstd_vec_into_heap_ptr(vec: NSTDVec) -> crate::heap_ptr::NSTDHeapPtr {
+    use crate::{core::ptr::nstd_core_ptr_mut_new, heap_ptr::NSTDHeapPtr};
+    // The heap pointer frees it's allocation with the unaligned deallocator.
+    assert!(vec.align <= 1);
+    let mut vec = core::mem::ManuallyDrop::new(vec);
+    // Shrink the buffer so that it's size matches the vector's active length.
+    if !vec.buffer.ptr.raw.is_null() && vec.len < vec.buffer.len {
+        assert!(nstd_vec_shrink(&mut vec) == 0);
+    }
+    let size = vec.buffer.byte_len();
+    NSTDHeapPtr::from_raw(nstd_core_ptr_mut_new(vec.buffer.ptr.raw, size))
+}
+
 /// Reserves some space on the heap for at least `size` more elements to be pushed onto a vector
 /// without making more allocations.
 ///
+/// To amortize the cost of repeated small reservations, this may reserve more space than
+/// requested, growing the vector's capacity by it's growth factor (at least half by default, see
+/// `nstd_vec_set_growth_policy`). Use `nstd_vec_reserve_exact` when the final size is known up
+/// front.
+///
 /// # Parameters:
 ///
 /// - `NSTDVec *vec` - The vector to reserve space for.
@@ -532,14 +1049,43 @@ pub extern "C" fn nstd_vec_truncate(vec: &mut NSTDVec, len: NSTDUSize) {
 /// # Panics
 ///
 /// This operation will panic if `size` is zero.
+#[inline]
 #[cfg_attr(feature = "clib", no_mangle)]
 pub extern "C" fn nstd_vec_reserve(vec: &mut NSTDVec, size: NSTDUSize) -> NSTDErrorCode {
+    nstd_vec_reserve_exact(vec, size.max(1 + vec.buffer.len * (vec.growth - 100) / 100))
+}
+
+/// Reserves space on the heap for exactly `size` more elements to be pushed onto a vector without
+/// making more allocations.
+///
+/// # Parameters:
+///
+/// - `NSTDVec *vec` - The vector to reserve space for.
+///
+/// - `NSTDUSize size` - The number of additional elements to allocate for.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Panics
+///
+/// This operation will panic if `size` is zero.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_vec_reserve_exact(vec: &mut NSTDVec, size: NSTDUSize) -> NSTDErrorCode {
     assert!(size != 0);
+    #[cfg(feature = "nstd_alloc_stats")]
+    crate::alloc::stats::record_vec_reserve();
     // Calculate the number of bytes to allocate.
     let bytes_to_alloc = size * vec.buffer.ptr.size;
     // Checking if the vector is null and needs to make it's first allocation.
     if vec.buffer.ptr.raw.is_null() {
-        let mem = unsafe { nstd_alloc_allocate(bytes_to_alloc) };
+        let mem = match vec.align > 1 {
+            // SAFETY: Both the allocation size and the vector's alignment have been checked.
+            true => unsafe { nstd_alloc_allocate_aligned(bytes_to_alloc, vec.align) },
+            // SAFETY: `bytes_to_alloc` is never zero.
+            false => unsafe { nstd_alloc_allocate(bytes_to_alloc) },
+        };
         if !mem.is_null() {
             vec.buffer.ptr.raw = mem;
             vec.buffer.len = size;
@@ -551,8 +1097,20 @@ pub extern "C" fn nstd_vec_reserve(vec: &mut NSTDVec, size: NSTDUSize) -> NSTDEr
     else {
         let current_byte_len = vec.buffer.byte_len();
         let new_byte_len = current_byte_len + bytes_to_alloc;
-        let errc = unsafe {
-            nstd_alloc_reallocate(&mut vec.buffer.ptr.raw, current_byte_len, new_byte_len)
+        let errc = match vec.align > 1 {
+            // SAFETY: The buffer was allocated with `vec.align` alignment.
+            true => unsafe {
+                nstd_alloc_reallocate_aligned(
+                    &mut vec.buffer.ptr.raw,
+                    current_byte_len,
+                    new_byte_len,
+                    vec.align,
+                )
+            },
+            // SAFETY: The vector's buffer is non-null.
+            false => unsafe {
+                nstd_alloc_reallocate(&mut vec.buffer.ptr.raw, current_byte_len, new_byte_len)
+            },
         };
         // On success increase the buffer length.
         if errc == 0 {
@@ -562,7 +1120,11 @@ pub extern "C" fn nstd_vec_reserve(vec: &mut NSTDVec, size: NSTDUSize) -> NSTDEr
     }
 }
 
-/// Decreases a vector's capacity to match it's length.
+/// Decreases a vector's capacity to match it's length, plus the vector's minimum slack.
+///
+/// Keeping a minimum amount of spare capacity (see `nstd_vec_set_growth_policy`) lets vectors
+/// that repeatedly fill and drain settle at a stable capacity instead of oscillating between
+/// reallocations on growth and shrink.
 ///
 /// # Note
 ///
@@ -578,20 +1140,80 @@ pub extern "C" fn nstd_vec_reserve(vec: &mut NSTDVec, size: NSTDUSize) -> NSTDEr
 #[cfg_attr(feature = "clib", no_mangle)]
 pub extern "C" fn nstd_vec_shrink(vec: &mut NSTDVec) -> NSTDErrorCode {
     let mut errc = 0;
-    // Make sure the vector is non-null and it's capacity is greater than it's length.
-    if !vec.buffer.ptr.raw.is_null() && vec.len < vec.buffer.len {
+    // Make sure the vector is non-null and it's capacity is greater than it's length plus the
+    // minimum slack to keep.
+    let keep = vec.len + vec.min_slack;
+    if !vec.buffer.ptr.raw.is_null() && keep < vec.buffer.len {
         let current_len = vec.buffer.byte_len();
         // Make sure to allocate at least one element to avoid undefined behavior.
-        let new_len = vec.byte_len().max(vec.buffer.ptr.size);
-        errc = unsafe { nstd_alloc_reallocate(&mut vec.buffer.ptr.raw, current_len, new_len) };
+        let new_len = (keep * vec.buffer.ptr.size).max(vec.buffer.ptr.size);
+        errc = match vec.align > 1 {
+            // SAFETY: The buffer was allocated with `vec.align` alignment.
+            true => unsafe {
+                nstd_alloc_reallocate_aligned(
+                    &mut vec.buffer.ptr.raw,
+                    current_len,
+                    new_len,
+                    vec.align,
+                )
+            },
+            // SAFETY: The vector's buffer is non-null.
+            false => unsafe {
+                nstd_alloc_reallocate(&mut vec.buffer.ptr.raw, current_len, new_len)
+            },
+        };
         if errc == 0 {
             // The buffer's new length is at least 1.
-            vec.buffer.len = vec.len.max(1);
+            vec.buffer.len = keep.max(1);
         }
     }
     errc
 }
 
+/// Sets a vector's growth policy.
+///
+/// `growth` is the factor (as a percentage of the current capacity, at least 100) the capacity
+/// is grown by when `nstd_vec_reserve` needs more space, and `min_slack` is the minimum number
+/// of spare elements `nstd_vec_shrink` keeps as headroom. Vectors that repeatedly fill and drain
+/// can use the slack to settle at a stable capacity and stop reallocating entirely.
+///
+/// # Parameters:
+///
+/// - `NSTDVec *vec` - The vector.
+///
+/// - `NSTDUSize growth` - The vector's new growth factor as a percentage, at least 100.
+///
+/// - `NSTDUSize min_slack` - The minimum number of spare elements to keep when shrinking.
+///
+/// # Panics
+///
+/// This operation will panic if `growth` is less than 100.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_vec_set_growth_policy(
+    vec: &mut NSTDVec,
+    growth: NSTDUSize,
+    min_slack: NSTDUSize,
+) {
+    assert!(growth >= 100);
+    vec.growth = growth;
+    vec.min_slack = min_slack;
+}
+
+/// Removes all of a vector's elements without touching the vector's buffer.
+///
+/// The capacity is left intact so the vector can be refilled without reallocating, making it
+/// suitable for buffers that are reused across iterations.
+///
+/// # Parameters:
+///
+/// - `NSTDVec *vec` - The vector to clear.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_vec_clear_and_keep_cap(vec: &mut NSTDVec) {
+    vec.len = 0;
+}
+
 /// Frees an instance of `NSTDVec`.
 ///
 /// # Parameters:
@@ -0,0 +1,360 @@
+//! A copy-on-write wrapper around [NSTDVec][crate::vec::NSTDVec].
+//!
+//! Cloning an `NSTDCowVec` shares the underlying buffer between the clones through a reference
+//! count co-allocated at the end of the buffer, making clones O(1) and allocation free. A private
+//! copy of the buffer is only materialized once a mutable operation is invoked, so vectors that
+//! are cloned often but rarely mutated never pay for the copy.
+use crate::{
+    alloc::{nstd_alloc_allocate, nstd_alloc_deallocate, nstd_alloc_reallocate},
+    core::{
+        def::NSTDErrorCode,
+        mem::nstd_core_mem_copy,
+        slice::{nstd_core_slice_const_new, nstd_core_slice_mut_new, NSTDSliceConst, NSTDSliceMut},
+    },
+    vec::{nstd_vec_extend, nstd_vec_new, nstd_vec_push, NSTDVec},
+    NSTDAnyConst, NSTDAnyMut, NSTDUSize, NSTD_NULL,
+};
+use core::mem::ManuallyDrop;
+
+/// The size (in bytes) of [usize].
+const USIZE_SIZE: usize = core::mem::size_of::<usize>();
+
+/// A copy-on-write wrapper around [NSTDVec][crate::vec::NSTDVec].
+#[repr(C)]
+#[derive(Debug, Hash)]
+pub struct NSTDCowVec {
+    /// The vector, it's buffer may be shared with other clones while `owners` is non-null.
+    vec: ManuallyDrop<NSTDVec>,
+    /// A pointer to the shared buffer's owner count, null while the vector owns it's buffer
+    /// privately.
+    owners: NSTDAnyMut,
+}
+impl NSTDCowVec {
+    /// Returns the buffer's owner count.
+    ///
+    /// The owner count slot directly follows the buffer's elements and is not necessarily aligned
+    /// for [usize], so it is always read and written unaligned.
+    ///
+    /// # Safety
+    ///
+    /// `self.owners` must be non-null.
+    #[inline]
+    unsafe fn owner_count(&self) -> usize {
+        self.owners.cast::<usize>().read_unaligned()
+    }
+
+    /// Sets the buffer's owner count.
+    ///
+    /// # Safety
+    ///
+    /// `self.owners` must be non-null.
+    #[inline]
+    unsafe fn set_owner_count(&mut self, owners: usize) {
+        self.owners.cast::<usize>().write_unaligned(owners);
+    }
+
+    /// Materializes a private copy of the vector's buffer if it is currently shared.
+    ///
+    /// Returns nonzero if allocating the private copy fails.
+    fn materialize(&mut self) -> NSTDErrorCode {
+        if self.owners.is_null() {
+            return 0;
+        }
+        let byte_cap = self.vec.buffer.byte_len();
+        // SAFETY: The vector's buffer is non-null while it is shared.
+        unsafe {
+            // As the sole owner, reclaim the buffer in place by releasing the owner count slot.
+            if self.owner_count() == 1 {
+                if nstd_alloc_reallocate(
+                    &mut self.vec.buffer.ptr.raw,
+                    byte_cap + USIZE_SIZE,
+                    byte_cap,
+                ) != 0
+                {
+                    return 1;
+                }
+                self.owners = NSTD_NULL;
+                return 0;
+            }
+            // Otherwise copy the active elements into a private buffer.
+            let mem = nstd_alloc_allocate(byte_cap);
+            if mem.is_null() {
+                return 1;
+            }
+            nstd_core_mem_copy(
+                mem.cast(),
+                self.vec.buffer.ptr.raw.cast(),
+                self.vec.byte_len(),
+            );
+            self.set_owner_count(self.owner_count() - 1);
+            self.vec.buffer.ptr.raw = mem;
+        }
+        self.owners = NSTD_NULL;
+        0
+    }
+}
+impl Drop for NSTDCowVec {
+    /// [NSTDCowVec]'s destructor.
+    fn drop(&mut self) {
+        match self.owners.is_null() {
+            // The buffer is private, let the vector free it.
+            // SAFETY: The vector is never used again.
+            true => unsafe { ManuallyDrop::drop(&mut self.vec) },
+            // SAFETY: The vector's buffer is non-null while it is shared.
+            false => unsafe {
+                let owners = self.owner_count() - 1;
+                self.set_owner_count(owners);
+                // The last owner frees the shared buffer along with it's co-allocated owner count.
+                if owners == 0 {
+                    let buffer_size = self.vec.buffer.byte_len() + USIZE_SIZE;
+                    nstd_alloc_deallocate(&mut self.vec.buffer.ptr.raw, buffer_size);
+                }
+            },
+        }
+    }
+}
+
+/// Creates a new copy-on-write vector, taking ownership of `vec`.
+///
+/// # Parameters:
+///
+/// - `NSTDVec vec` - The vector to wrap.
+///
+/// # Returns
+///
+/// `NSTDCowVec cow` - The new copy-on-write vector.
+///
+/// # Panics
+///
+/// This operation will panic if `vec`'s buffer is aligned above one byte.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_cow_vec_from_vec(vec: NSTDVec) -> NSTDCowVec {
+    // The shared buffer is managed with the unaligned allocator.
+    assert!(vec.align <= 1);
+    NSTDCowVec {
+        vec: ManuallyDrop::new(vec),
+        owners: NSTD_NULL,
+    }
+}
+
+/// Creates a new clone of `cow` that shares it's buffer.
+///
+/// This operation is O(1) and does not copy the vector's elements, the buffer is shared between
+/// the clones until one of them is mutated. The first clone of a privately owned buffer extends
+/// the buffer's allocation to make room for the owner count.
+///
+/// # Parameters:
+///
+/// - `NSTDCowVec *cow` - The vector to clone.
+///
+/// # Returns
+///
+/// `NSTDCowVec cloned` - The new clone of `cow`.
+///
+/// # Panics
+///
+/// This operation will panic if allocating space for the owner count fails.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_cow_vec_clone(cow: &mut NSTDCowVec) -> NSTDCowVec {
+    // Null vectors have no buffer to share.
+    if cow.vec.buffer.ptr.raw.is_null() {
+        return nstd_cow_vec_from_vec(nstd_vec_new(cow.vec.buffer.ptr.size));
+    }
+    // SAFETY: The vector's buffer is non-null.
+    unsafe {
+        // Move a privately owned buffer into a shared allocation by appending the owner count.
+        if cow.owners.is_null() {
+            let byte_cap = cow.vec.buffer.byte_len();
+            assert!(
+                nstd_alloc_reallocate(&mut cow.vec.buffer.ptr.raw, byte_cap, byte_cap + USIZE_SIZE)
+                    == 0
+            );
+            cow.owners = cow.vec.buffer.ptr.raw.add(byte_cap);
+            cow.set_owner_count(1);
+        }
+        cow.set_owner_count(cow.owner_count() + 1);
+    }
+    NSTDCowVec {
+        vec: ManuallyDrop::new(NSTDVec {
+            buffer: nstd_core_slice_mut_new(
+                cow.vec.buffer.ptr.raw,
+                cow.vec.buffer.ptr.size,
+                cow.vec.buffer.len,
+            ),
+            len: cow.vec.len,
+            align: 1,
+            growth: cow.vec.growth,
+            min_slack: cow.vec.min_slack,
+        }),
+        owners: cow.owners,
+    }
+}
+
+/// Returns the number of vectors sharing `cow`'s buffer.
+///
+/// # Parameters:
+///
+/// - `const NSTDCowVec *cow` - The copy-on-write vector.
+///
+/// # Returns
+///
+/// `NSTDUSize owners` - The number of vectors sharing `cow`'s buffer, 1 if the buffer is privately
+/// owned.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_cow_vec_owners(cow: &NSTDCowVec) -> NSTDUSize {
+    match cow.owners.is_null() {
+        true => 1,
+        // SAFETY: `cow.owners` points to the buffer's co-allocated owner count.
+        false => unsafe { cow.owner_count() },
+    }
+}
+
+/// Returns the length of a copy-on-write vector.
+///
+/// # Parameters:
+///
+/// - `const NSTDCowVec *cow` - The copy-on-write vector.
+///
+/// # Returns
+///
+/// `NSTDUSize len` - The length of the vector.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_cow_vec_len(cow: &NSTDCowVec) -> NSTDUSize {
+    cow.vec.len
+}
+
+/// Returns an immutable slice containing all of a copy-on-write vector's active elements.
+///
+/// This operation never materializes a private copy.
+///
+/// # Parameters:
+///
+/// - `const NSTDCowVec *cow` - The copy-on-write vector.
+///
+/// # Returns
+///
+/// `NSTDSliceConst slice` - An *immutable* view into the vector.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_cow_vec_as_slice(cow: &NSTDCowVec) -> NSTDSliceConst {
+    nstd_core_slice_const_new(cow.vec.buffer.ptr.raw, cow.vec.buffer.ptr.size, cow.vec.len)
+}
+
+/// Returns a mutable slice containing all of a copy-on-write vector's active elements,
+/// materializing a private copy of the buffer if it is currently shared.
+///
+/// # Parameters:
+///
+/// - `NSTDCowVec *cow` - The copy-on-write vector.
+///
+/// # Returns
+///
+/// `NSTDSliceMut slice` - A *mutable* view into the vector, or an empty slice if materializing a
+/// private copy of the buffer fails.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_cow_vec_as_slice_mut(cow: &mut NSTDCowVec) -> NSTDSliceMut {
+    if cow.materialize() != 0 {
+        return nstd_core_slice_mut_new(NSTD_NULL, cow.vec.buffer.ptr.size, 0);
+    }
+    nstd_core_slice_mut_new(cow.vec.buffer.ptr.raw, cow.vec.buffer.ptr.size, cow.vec.len)
+}
+
+/// Pushes a value onto a copy-on-write vector, materializing a private copy of the buffer if it
+/// is currently shared.
+///
+/// # Parameters:
+///
+/// - `NSTDCowVec *cow` - The copy-on-write vector.
+///
+/// - `NSTDAnyConst value` - A pointer to the value to push onto the vector.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// This operation is unsafe because undefined behaviour can occur if the size of the value being
+/// pushed onto the vector is not equal to the vector's element size.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_cow_vec_push(
+    cow: &mut NSTDCowVec,
+    value: NSTDAnyConst,
+) -> NSTDErrorCode {
+    if cow.materialize() != 0 {
+        return 1;
+    }
+    nstd_vec_push(&mut cow.vec, value)
+}
+
+/// Pushes a series of values onto a copy-on-write vector, materializing a private copy of the
+/// buffer if it is currently shared.
+///
+/// # Parameters:
+///
+/// - `NSTDCowVec *cow` - The copy-on-write vector to extend.
+///
+/// - `const NSTDSliceConst *values` - A slice of values to push onto the vector.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Panics
+///
+/// This operation will panic if the element sizes for `cow` and `values` do not match.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `values`'s data is invalid.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_cow_vec_extend(
+    cow: &mut NSTDCowVec,
+    values: &NSTDSliceConst,
+) -> NSTDErrorCode {
+    if cow.materialize() != 0 {
+        return 1;
+    }
+    nstd_vec_extend(&mut cow.vec, values)
+}
+
+/// Returns ownership of a copy-on-write vector's data as an `NSTDVec`, taking ownership of `cow`.
+///
+/// If the buffer is privately owned this is a simple handoff, otherwise a private copy of the
+/// buffer is materialized first.
+///
+/// # Parameters:
+///
+/// - `NSTDCowVec cow` - The copy-on-write vector.
+///
+/// # Returns
+///
+/// `NSTDVec vec` - A vector that privately owns the data.
+///
+/// # Panics
+///
+/// This operation will panic if materializing a private copy of the buffer fails.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_cow_vec_into_vec(cow: NSTDCowVec) -> NSTDVec {
+    let mut cow = ManuallyDrop::new(cow);
+    assert!(cow.materialize() == 0);
+    // SAFETY: `cow` is never used (or dropped) again.
+    unsafe { ManuallyDrop::take(&mut cow.vec) }
+}
+
+/// Frees an instance of `NSTDCowVec`.
+///
+/// # Parameters:
+///
+/// - `NSTDCowVec cow` - The copy-on-write vector to free.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+#[allow(unused_variables)]
+pub extern "C" fn nstd_cow_vec_free(cow: NSTDCowVec) {}
@@ -0,0 +1,351 @@
+//! A dynamically sized contiguous sequence of values with a small-buffer optimization.
+//!
+//! Unlike [NSTDVec][crate::vec::NSTDVec], an `NSTDSmallVec` begins life storing it's elements in a
+//! fixed size buffer inside the structure itself and only spills to the heap once it outgrows
+//! that buffer, making short-lived vectors of a few small elements allocation free.
+use crate::{
+    alloc::{nstd_alloc_allocate, nstd_alloc_deallocate, nstd_alloc_reallocate},
+    core::{
+        def::{NSTDByte, NSTDErrorCode},
+        mem::nstd_core_mem_copy,
+        slice::{nstd_core_slice_const_new, nstd_core_slice_mut_new, NSTDSliceConst, NSTDSliceMut},
+    },
+    NSTDAnyConst, NSTDAnyMut, NSTDBool, NSTDUSize, NSTD_NULL,
+};
+
+/// The size (in bytes) of a small vector's inline buffer.
+pub const NSTD_SMALL_VEC_BUFFER_SIZE: usize = 64;
+
+/// A dynamically sized contiguous sequence of values with a small-buffer optimization.
+#[repr(C)]
+#[derive(Debug, Hash)]
+pub struct NSTDSmallVec {
+    /// The inline memory buffer, active while the vector's elements fit within it.
+    buffer: [NSTDByte; NSTD_SMALL_VEC_BUFFER_SIZE],
+    /// A pointer to the heap memory buffer, null while the vector is inline.
+    ptr: NSTDAnyMut,
+    /// The size in bytes of each value in the vector.
+    element_size: NSTDUSize,
+    /// The number of elements the active memory buffer can hold.
+    cap: NSTDUSize,
+    /// The number of active elements in the vector.
+    len: NSTDUSize,
+}
+impl NSTDSmallVec {
+    /// Returns a raw pointer to the vector's active memory buffer.
+    #[inline]
+    fn data(&self) -> NSTDAnyConst {
+        match self.ptr.is_null() {
+            true => self.buffer.as_ptr().cast(),
+            false => self.ptr,
+        }
+    }
+
+    /// Returns a raw mutable pointer to the vector's active memory buffer.
+    #[inline]
+    fn data_mut(&mut self) -> NSTDAnyMut {
+        match self.ptr.is_null() {
+            true => self.buffer.as_mut_ptr().cast(),
+            false => self.ptr,
+        }
+    }
+
+    /// Attempts to reserve memory for at least `size` more elements if needed.
+    fn try_reserve(&mut self, size: NSTDUSize) -> NSTDErrorCode {
+        let reserved = self.cap - self.len;
+        if reserved < size {
+            // Grow the capacity by at least half to amortize repeated small reservations.
+            let new_cap = (self.len + size).max(self.cap + 1 + self.cap / 2);
+            let new_byte_len = new_cap * self.element_size;
+            if self.ptr.is_null() {
+                // Spilling out of the inline buffer, copy the active elements to the heap.
+                // SAFETY: `new_byte_len` is never zero here.
+                let mem = unsafe { nstd_alloc_allocate(new_byte_len) };
+                if mem.is_null() {
+                    return 1;
+                }
+                // SAFETY: The active elements fit in both buffers.
+                unsafe {
+                    nstd_core_mem_copy(
+                        mem.cast(),
+                        self.buffer.as_ptr(),
+                        self.len * self.element_size,
+                    );
+                }
+                self.ptr = mem;
+            } else {
+                let byte_len = self.cap * self.element_size;
+                // SAFETY: The vector's heap buffer is non-null.
+                let errc = unsafe { nstd_alloc_reallocate(&mut self.ptr, byte_len, new_byte_len) };
+                if errc != 0 {
+                    return errc;
+                }
+            }
+            self.cap = new_cap;
+        }
+        0
+    }
+}
+impl Drop for NSTDSmallVec {
+    /// [NSTDSmallVec]'s destructor.
+    #[inline]
+    fn drop(&mut self) {
+        if !self.ptr.is_null() {
+            // SAFETY: The vector's heap buffer is non-null.
+            unsafe { nstd_alloc_deallocate(&mut self.ptr, self.cap * self.element_size) };
+        }
+    }
+}
+
+/// Creates a new small vector without allocating any resources.
+///
+/// # Parameters:
+///
+/// - `NSTDUSize element_size` - The size in bytes of each value in the vector.
+///
+/// # Returns
+///
+/// `NSTDSmallVec vec` - The new small vector.
+///
+/// # Panics
+///
+/// This function will panic if `element_size` is zero.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_vec_small_new(element_size: NSTDUSize) -> NSTDSmallVec {
+    assert!(element_size != 0);
+    NSTDSmallVec {
+        buffer: [0; NSTD_SMALL_VEC_BUFFER_SIZE],
+        ptr: NSTD_NULL,
+        element_size,
+        cap: NSTD_SMALL_VEC_BUFFER_SIZE / element_size,
+        len: 0,
+    }
+}
+
+/// Returns the length of a small vector.
+///
+/// # Parameters:
+///
+/// - `const NSTDSmallVec *vec` - The small vector.
+///
+/// # Returns
+///
+/// `NSTDUSize len` - The length of the small vector.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_vec_small_len(vec: &NSTDSmallVec) -> NSTDUSize {
+    vec.len
+}
+
+/// Returns a small vector's capacity.
+///
+/// This is the number of elements the small vector can contain without reallocating.
+///
+/// # Parameters:
+///
+/// - `const NSTDSmallVec *vec` - The small vector.
+///
+/// # Returns
+///
+/// `NSTDUSize cap` - The small vector's capacity.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_vec_small_cap(vec: &NSTDSmallVec) -> NSTDUSize {
+    vec.cap
+}
+
+/// Determines whether or not a small vector's elements have spilled to the heap.
+///
+/// # Parameters:
+///
+/// - `const NSTDSmallVec *vec` - The small vector.
+///
+/// # Returns
+///
+/// `NSTDBool is_heap` - `NSTD_TRUE` if the small vector's elements live on the heap.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_vec_small_is_heap(vec: &NSTDSmallVec) -> NSTDBool {
+    !vec.ptr.is_null() as NSTDBool
+}
+
+/// Returns an immutable slice containing all of a small vector's active elements.
+///
+/// # Parameters:
+///
+/// - `const NSTDSmallVec *vec` - The small vector.
+///
+/// # Returns
+///
+/// `NSTDSliceConst slice` - An *immutable* view into the small vector.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_vec_small_as_slice(vec: &NSTDSmallVec) -> NSTDSliceConst {
+    nstd_core_slice_const_new(vec.data(), vec.element_size, vec.len)
+}
+
+/// Returns a slice containing all of a small vector's active elements.
+///
+/// # Parameters:
+///
+/// - `NSTDSmallVec *vec` - The small vector.
+///
+/// # Returns
+///
+/// `NSTDSliceMut slice` - A *mutable* view into the small vector.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_vec_small_as_slice_mut(vec: &mut NSTDSmallVec) -> NSTDSliceMut {
+    nstd_core_slice_mut_new(vec.data_mut(), vec.element_size, vec.len)
+}
+
+/// Returns a pointer to a small vector's raw data.
+///
+/// # Note
+///
+/// It is highly advised to copy the return value onto the stack because the pointer can easily
+/// become invalid if the small vector is mutated.
+///
+/// # Parameters:
+///
+/// - `const NSTDSmallVec *vec` - The small vector.
+///
+/// # Returns
+///
+/// `NSTDAnyConst ptr` - A pointer to the small vector's raw data.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_vec_small_as_ptr(vec: &NSTDSmallVec) -> NSTDAnyConst {
+    vec.data()
+}
+
+/// Returns a pointer to a small vector's raw data.
+///
+/// # Note
+///
+/// It is highly advised to copy the return value onto the stack because the pointer can easily
+/// become invalid if the small vector is mutated.
+///
+/// # Parameters:
+///
+/// - `NSTDSmallVec *vec` - The small vector.
+///
+/// # Returns
+///
+/// `NSTDAnyMut ptr` - A pointer to the small vector's raw data.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_vec_small_as_mut_ptr(vec: &mut NSTDSmallVec) -> NSTDAnyMut {
+    vec.data_mut()
+}
+
+/// Pushes a value onto a small vector by copying bytes to the end of the vector's active buffer.
+/// The number of bytes to push is determined by `vec`'s element size.
+///
+/// # Parameters:
+///
+/// - `NSTDSmallVec *vec` - The small vector.
+///
+/// - `NSTDAnyConst value` - A pointer to the value to push onto the small vector.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero on error.
+///
+/// # Safety
+///
+/// This operation is unsafe because undefined behaviour can occur if the size of the value being
+/// pushed onto the small vector is not equal to `vec`'s element size.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_vec_small_push(
+    vec: &mut NSTDSmallVec,
+    value: NSTDAnyConst,
+) -> NSTDErrorCode {
+    // Attempt to reserve space for the push.
+    let errc = vec.try_reserve(1);
+    // On success: copy bytes to the end of the vector.
+    if errc == 0 {
+        let end = vec.data_mut().add(vec.len * vec.element_size);
+        nstd_core_mem_copy(end.cast(), value.cast(), vec.element_size);
+        vec.len += 1;
+    }
+    errc
+}
+
+/// Removes the last value of a small vector and returns a pointer to it.
+///
+/// # Note
+///
+/// It is highly advised to copy the return value onto the stack because the pointer can easily
+/// become invalid if the small vector is mutated.
+///
+/// # Parameters:
+///
+/// - `NSTDSmallVec *vec` - The small vector.
+///
+/// # Returns
+///
+/// - `NSTDAnyConst value` - A pointer to the value that was popped off the stack, or null if the
+/// small vector is empty.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+pub extern "C" fn nstd_vec_small_pop(vec: &mut NSTDSmallVec) -> NSTDAnyConst {
+    if vec.len > 0 {
+        vec.len -= 1;
+        // SAFETY: The popped element is within the vector's active buffer.
+        return unsafe { vec.data().add(vec.len * vec.element_size) };
+    }
+    NSTD_NULL
+}
+
+/// Pushes a series of values onto a small vector.
+///
+/// # Parameters:
+///
+/// - `NSTDSmallVec *vec` - The small vector to extend.
+///
+/// - `const NSTDSliceConst *values` - A slice of values to push onto the small vector.
+///
+/// # Returns
+///
+/// `NSTDErrorCode errc` - Nonzero if reserving memory for the extension fails.
+///
+/// # Panics
+///
+/// This operation will panic if the element sizes for `vec` and `values` do not match.
+///
+/// # Safety
+///
+/// This operation can cause undefined behavior if `values`'s data is invalid.
+#[cfg_attr(feature = "clib", no_mangle)]
+pub unsafe extern "C" fn nstd_vec_small_extend(
+    vec: &mut NSTDSmallVec,
+    values: &NSTDSliceConst,
+) -> NSTDErrorCode {
+    // Ensure value sizes are the same for both the vector and the slice.
+    assert!(vec.element_size == values.ptr.size);
+    // Making sure there's enough space for the extension.
+    let errc = match values.len > 0 {
+        true => vec.try_reserve(values.len),
+        false => 0,
+    };
+    // On success copy bytes to the end of the vector.
+    if errc == 0 {
+        let end = vec.data_mut().add(vec.len * vec.element_size);
+        nstd_core_mem_copy(end.cast(), values.ptr.raw.cast(), values.byte_len());
+        vec.len += values.len;
+    }
+    errc
+}
+
+/// Frees an instance of `NSTDSmallVec`.
+///
+/// # Parameters:
+///
+/// - `NSTDSmallVec vec` - The small vector to free.
+#[inline]
+#[cfg_attr(feature = "clib", no_mangle)]
+#[allow(unused_variables)]
+pub extern "C" fn nstd_vec_small_free(vec: NSTDSmallVec) {}
@@ -1,7 +1,8 @@
 import os
 
-FEATURES = ("nstd_alloc", "nstd_core", "nstd_cstring", "nstd_heap_ptr",
-            "nstd_os_windows_alloc", "nstd_shared_ptr", "nstd_string", "nstd_vec")
+FEATURES = ("nstd_alloc", "nstd_alloc_pool", "nstd_alloc_stats", "nstd_core", "nstd_core_par", "nstd_cstring", "nstd_hash_map", "nstd_heap_ptr",
+            "nstd_interner", "nstd_os_unix_mmap", "nstd_os_windows_alloc", "nstd_os_windows_mmap", "nstd_queue", "nstd_shared_ptr", "nstd_string",
+            "nstd_vec")
 
 TARGETS = ("x86_64-pc-windows-msvc", "x86_64-apple-darwin",
            "x86_64-unknown-linux-gnu", "x86_64-apple-ios", "x86_64-linux-android")